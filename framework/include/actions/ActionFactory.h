@@ -21,6 +21,7 @@
 
 #include "Action.h" // Technically required for std::shared_ptr<Action>(Action*) constructor
 #include "InputParameters.h"
+#include "Factory.h"
 #include "FileLineInfo.h"
 
 /**
@@ -88,6 +89,7 @@ public:
     _name_to_build_info.insert(std::make_pair(name, build_info));
     _task_to_action_map.insert(std::make_pair(task, name));
     _name_to_line.addInfo(name, task, file, line);
+    Factory::noteRegistration("Action " + name + " " + task);
   }
 
   /**
@@ -98,6 +100,9 @@ public:
    */
   FileLineInfo getLineInfo(const std::string & name, const std::string & task) const;
 
+  /// The application that owns this ActionFactory
+  MooseApp & app() { return _app; }
+
   std::string getTaskName(const std::string & action);
 
   std::shared_ptr<Action>
@@ -90,6 +90,20 @@ public:
 
   const std::set<std::string> & getDependObjects() const { return _depend_uo; }
 
+  /**
+   * The inputs that the computed values depend on (see the 'depends_on' parameter)
+   */
+  const MultiMooseEnum & dependsOn() const { return _depends_on; }
+
+  ///@{
+  /**
+   * When the values are up to date the computation is skipped for the current execution, this
+   * is set by the AuxiliarySystem based on the inputs that the values depend on
+   */
+  bool isUpToDate() const { return _up_to_date; }
+  void setUpToDate(bool up_to_date) { _up_to_date = up_to_date; }
+  ///@}
+
   void coupledCallback(const std::string & var_name, bool is_old) override;
 
   virtual const std::set<std::string> & getRequestedItems() override;
@@ -207,6 +221,12 @@ protected:
   DenseVector<Number> _local_sol;
   /// for holding local mass matrix
   DenseMatrix<Number> _local_ke;
+
+  /// The inputs that the computed values depend on
+  const MultiMooseEnum & _depends_on;
+
+  /// True when the computation may be skipped for the current execution
+  bool _up_to_date;
 };
 
 template <typename T>
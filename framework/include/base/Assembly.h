@@ -21,9 +21,13 @@
 // libMesh
 #include "libmesh/dense_matrix.h"
 #include "libmesh/dense_vector.h"
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/fe_type.h"
 
+// C++ includes
+#include <tuple>
+
 // libMesh forward declarations
 namespace libMesh
 {
@@ -386,6 +390,14 @@ public:
    */
   void useFECache(bool fe_cache) { _should_use_fe_cache = fe_cache; }
 
+  /**
+   * Whether or not the reference shape functions should be shared between affine elements.
+   *
+   * @param share_affine_fe True for sharing, in which case only the map is computed for each
+   * affine element.
+   */
+  void shareAffineFE(bool share_affine_fe) { _share_affine_fe = share_affine_fe; }
+
   void prepare();
   void prepareNonlocal();
 
@@ -608,6 +620,23 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * Returns true if the shape functions of the FE type can be computed from the shared reference
+   * values on affine elements
+   */
+  bool affineFESharable(const FEType & fe_type) const;
+
+  /**
+   * Computes the shape functions of an affine element from the shared reference values and the
+   * map of the element, which must have been computed by the FE helper object.
+   *
+   * @param elem The affine element we are using to reinit
+   * @param fe_type The FE type of the shape functions
+   * @param fe The FE object of the type, used to compute the reference values the first time
+   * @param fesd The shape function data that is set
+   */
+  void reinitAffineFE(const Elem * elem, const FEType & fe_type, FEBase * fe, FEShapeData & fesd);
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -892,6 +921,29 @@ protected:
   /// Whether or not fe should currently be cached - This will be false if something funky is going on with the quadrature rules.
   bool _currently_fe_caching;
 
+  /**
+   * The shape functions and their derivatives at the reference quadrature points, these are the
+   * same for every element of a type so they are shared by all the affine elements.
+   */
+  class AffineFEShapeData
+  {
+  public:
+    std::vector<std::vector<Real>> _phi;
+    std::vector<std::vector<Real>> _dphidxi;
+    std::vector<std::vector<Real>> _dphideta;
+    std::vector<std::vector<Real>> _dphidzeta;
+  };
+
+  /// Whether or not the reference shape functions are shared between affine elements
+  bool _share_affine_fe;
+
+  /// Shared reference shape functions by element type, quadrature rule (type, order, and number of points), and FE type
+  std::map<std::tuple<ElemType, QuadratureType, Order, unsigned int, FEType>, AffineFEShapeData>
+      _affine_fe_shape_data;
+
+  /// The shape function gradients computed from the shared reference values for each FE type
+  std::map<FEType, std::vector<std::vector<RealGradient>>> _affine_grad_phi;
+
   // Shape function values, gradients. second derivatives for each FE type
   std::map<FEType, FEShapeData *> _fe_shape_data;
   std::map<FEType, FEShapeData *> _fe_shape_data_face;
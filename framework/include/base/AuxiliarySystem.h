@@ -165,11 +165,67 @@ public:
 
   virtual void setPreviousNewtonSolution();
 
+  /**
+   * Called when the mesh changes, the AuxKernel objects that depend on their inputs (see the
+   * AuxKernel 'depends_on' parameter) are computed at their next execution.
+   */
+  void meshChanged();
+
 protected:
   void computeScalarVars(ExecFlagType type);
   void computeNodalVars(ExecFlagType type);
   void computeElementalVars(ExecFlagType type);
 
+  /// The values of a variable coupled by AuxKernel objects, used to detect changes
+  struct CoupledVariableState
+  {
+    /// The variable (thread 0 copy)
+    MooseVariable * var;
+    /// The local degrees of freedom of the variable
+    std::vector<dof_id_type> dof_indices;
+    /// The local values of the variable at the last check
+    std::vector<Number> values;
+    /// Incremented each time the values of the variable change
+    unsigned int revision;
+  };
+
+  /// The inputs of an AuxKernel at its last evaluation
+  struct AuxKernelState
+  {
+    AuxKernelState() : computed(false), time(0), t_step(0) {}
+
+    bool computed;
+    Real time;
+    int t_step;
+    /// The revisions of the coupled variables
+    std::map<std::string, unsigned int> revisions;
+  };
+
+  /**
+   * Marks the block (or boundary) restricted AuxKernel objects whose values are up to date,
+   * based on the inputs that they depend on.
+   * @return True if any of the objects must be computed
+   */
+  bool updateUpToDate(const MooseObjectWarehouse<AuxKernel> & storage, bool boundary);
+
+  /**
+   * Returns the state of a variable coupled by AuxKernel objects, tracking of the variable
+   * begins with the first call.
+   */
+  CoupledVariableState & coupledVariableState(MooseVariable & var);
+
+  /**
+   * Increments the revisions of the variables coupled by the block (or boundary) restricted
+   * AuxKernel objects that depend on them, if their values changed since the last check
+   */
+  void updateCoupledRevisions(const MooseObjectWarehouse<AuxKernel> & storage, bool boundary);
+
+  /**
+   * Returns true if any of the block (or boundary) restricted AuxKernel objects read the values
+   * of auxiliary variables, either directly or through material properties.
+   */
+  bool readsAuxVariables(const MooseObjectWarehouse<AuxKernel> & storage, bool boundary) const;
+
   FEProblemBase & _fe_problem;
 
   TransientExplicitSystem & _sys;
@@ -201,6 +257,12 @@ protected:
   // Storage for AuxKernel objects
   ExecuteMooseObjectWarehouse<AuxKernel> _elemental_aux_storage;
 
+  /// The states of the variables coupled by AuxKernel objects that depend on them, by name
+  std::map<std::string, CoupledVariableState> _coupled_variable_states;
+
+  /// The inputs of each AuxKernel at its last evaluation, by name
+  std::map<std::string, AuxKernelState> _aux_kernel_states;
+
   friend class AuxKernel;
   friend class ComputeNodalAuxVarsThread;
   friend class ComputeNodalAuxBcsThread;
@@ -22,9 +22,11 @@
 // libMesh
 #include "libmesh/equation_systems.h"
 #include "libmesh/enum_quadrature_type.h"
+#include "libmesh/threads.h"
 
 // Forward declarations
 class MooseVariable;
+class UpdateDisplacedMeshThread;
 class AssemblyData;
 class DisplacedProblem;
 class MooseMesh;
@@ -65,6 +67,14 @@ public:
    */
   virtual void useFECache(bool fe_cache) override;
 
+  /**
+   * Whether or not this problem should share the reference shape functions between affine
+   * elements.
+   *
+   * @param share_affine_fe True for sharing false for not.
+   */
+  virtual void shareAffineFE(bool share_affine_fe) override;
+
   virtual void init() override;
   virtual void solve() override;
   virtual bool converged() override;
@@ -264,7 +274,36 @@ public:
    */
   void undisplaceMesh();
 
+  /**
+   * Whether or not the displaced nodes are only moved when they are used by the reinit methods.
+   */
+  bool lazyDisplacement() const { return _displacing_lazily; }
+
+  /**
+   * Moves any nodes that have not been displaced since the last updateMesh(). This must be called
+   * before the displaced mesh is used outside of the reinit methods (e.g., for output).
+   */
+  void displaceAllNodes();
+
 protected:
+  /**
+   * Displaces the nodes, or prepares the lazy displacement, from the current solutions.
+   */
+  void updateDisplacements();
+
+  /**
+   * Returns true when the displaced mesh is searched by position (geometric search or
+   * DiracKernels), in which case every node must be displaced on each update.
+   */
+  bool requiresFullDisplacement();
+
+  /**
+   * Moves the displaced counterpart of the supplied node (or of the nodes of the element) if it
+   * has not been displaced since the last updateMesh(), when lazy displacement is active.
+   */
+  void displaceNode(const Node * node);
+  void displaceElem(const Elem * elem);
+
   FEProblemBase & _mproblem;
   MooseMesh & _mesh;
   EquationSystems _eq;
@@ -282,6 +321,30 @@ protected:
 
   GeometricSearchData _geometric_search_data;
 
+  /// True when lazy displacement was requested for this problem
+  const bool _lazy_displacement;
+
+  /// True when the nodes are displaced as they are reinited, since the last updateMesh()
+  bool _displacing_lazily;
+
+  /// The displacement variable numbers and directions in the displaced nonlinear system
+  std::vector<std::pair<unsigned int, unsigned int>> _lazy_nl_vars;
+
+  /// The displacement variable numbers and directions in the displaced auxiliary system
+  std::vector<std::pair<unsigned int, unsigned int>> _lazy_aux_vars;
+
+  /// Incremented on each lazy update, the nodes stamped with this value are up to date
+  unsigned int _displacement_generation;
+
+  /// The generation at which all of the nodes were last displaced
+  unsigned int _all_nodes_generation;
+
+  /// The generation at which each displaced node (by id) was last displaced
+  std::vector<unsigned int> _node_generation;
+
+  /// Mutexes guarding the lazy displacement of the nodes, the nodes are assigned by id
+  std::vector<Threads::spin_mutex> _node_mutexes;
+
 private:
   friend class UpdateDisplacedMeshThread;
   friend class Restartable;
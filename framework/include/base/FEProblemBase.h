@@ -32,6 +32,7 @@
 #include "MooseVariableBase.h"
 #include "MultiAppTransfer.h"
 #include "Postprocessor.h"
+#include "ReductionBufferInterface.h"
 
 #include "libmesh/enum_quadrature_type.h"
 #include "libmesh/equation_systems.h"
@@ -398,6 +399,14 @@ public:
    */
   virtual void useFECache(bool fe_cache) override;
 
+  /**
+   * Whether or not this problem should share the reference shape functions between affine
+   * elements.
+   *
+   * @param share_affine_fe True for sharing false for not.
+   */
+  virtual void shareAffineFE(bool share_affine_fe) override;
+
   virtual void init() override;
   virtual void solve() override;
 
@@ -519,6 +528,18 @@ public:
    * Retrieve a writable reference the PETSc options (used by PetscSupport)
    */
   Moose::PetscSupport::PetscOptions & getPetscOptions() { return _petsc_options; }
+
+  /**
+   * Set the prefix of the PETSc options of this problem's solver.  A problem with a prefix
+   * does not set its PETSc options in solve(); whoever sets the prefix must call
+   * Moose::PetscSupport::petscSetOptions before each solve instead.
+   */
+  void setPetscOptionsPrefix(const std::string & prefix) { _petsc_options_prefix = prefix; }
+
+  /**
+   * The prefix of the PETSc options of this problem's solver, empty if there is none
+   */
+  const std::string & getPetscOptionsPrefix() const { return _petsc_options_prefix; }
 #endif // LIBMESH_HAVE_PETSC
 
   // Function /////
@@ -1555,6 +1576,9 @@ protected:
 #ifdef LIBMESH_HAVE_PETSC
   /// PETSc option storage
   Moose::PetscSupport::PetscOptions _petsc_options;
+
+  /// Prefix of the PETSc options of this problem's solver
+  std::string _petsc_options_prefix;
 #endif // LIBMESH_HAVE_PETSC
 
 private:
@@ -1567,6 +1591,10 @@ private:
   /// At or beyond initialSteup stage
   bool _started_initial_setup;
 
+  /// Whether or not the reference shape functions are shared between affine elements, this is
+  /// also applied to a displaced problem added later
+  bool _share_affine_fe;
+
   friend class AuxiliarySystem;
   friend class NonlinearSystemBase;
   friend class MooseEigenSystem;
@@ -1606,14 +1634,25 @@ FEProblemBase::finalizeUserObjects(const MooseObjectWarehouse<T> & warehouse)
   {
     const auto & objects = warehouse.getActiveObjects(0);
 
-    // Join them down to processor 0
-    for (THREAD_ID tid = 1; tid < libMesh::n_threads(); ++tid)
-    {
-      const auto & other_objects = warehouse.getActiveObjects(tid);
-
+    // Join them down to thread 0
+    if (libMesh::n_threads() > 1)
       for (unsigned int i = 0; i < objects.size(); ++i)
-        objects[i]->threadJoin(*(other_objects[i]));
-    }
+      {
+        // Objects with a reduction buffer join the entries of the buffer concurrently
+        auto buffer = std::dynamic_pointer_cast<ReductionBufferInterface>(objects[i]);
+        if (buffer)
+        {
+          std::vector<const UserObject *> copies;
+          for (THREAD_ID tid = 1; tid < libMesh::n_threads(); ++tid)
+            copies.push_back(warehouse.getActiveObjects(tid)[i].get());
+
+          buffer->parallelThreadJoin(copies);
+        }
+
+        else
+          for (THREAD_ID tid = 1; tid < libMesh::n_threads(); ++tid)
+            objects[i]->threadJoin(*(warehouse.getActiveObjects(tid)[i]));
+      }
 
     // Finalize them and save off PP values
     for (auto & object : objects)
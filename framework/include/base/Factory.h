@@ -175,10 +175,12 @@ public:
     if (_registerable_objects.empty() ||
         _registerable_objects.find(obj_name) != _registerable_objects.end())
     {
-      if (_name_to_build_pointer.find(obj_name) == _name_to_build_pointer.end())
+      // Only the functions are stored, validParams<T>() is not called until the parameters of
+      // the object are requested
+      if (_name_to_build_pointer.emplace(obj_name, &buildObject<T>).second)
       {
-        _name_to_build_pointer[obj_name] = &buildObject<T>;
-        _name_to_params_pointer[obj_name] = &validParams<T>;
+        _name_to_params_pointer.emplace(obj_name, &validParams<T>);
+        noteRegistration(obj_name);
       }
       else
         mooseError("Object '" + obj_name + "' already registered.");
@@ -250,6 +252,24 @@ public:
    */
   InputParameters getValidParams(const std::string & name);
 
+  /**
+   * Returns the parameters built by a validParams function.  The parameters built by each function
+   * are cached and shared by all of the apps (e.g. the sub-apps of a MultiApp), so building the
+   * parameters of an object usually only requires a copy.  The cached parameters are rebuilt after
+   * something new has been registered (see noteRegistration()), because some validParams
+   * functions list the registered objects or execute flags.
+   * @param params_func The validParams function of an object or Action
+   * @return A copy of the parameters returned by the function
+   */
+  static InputParameters validParamsTemplate(paramsPtr params_func);
+
+  /**
+   * Records the registration of an object, Action or execute flag.  Registering something for the
+   * first time in this process invalidates the parameters cached by validParamsTemplate().
+   * @param name A name that identifies what was registered
+   */
+  static void noteRegistration(const std::string & name);
+
   /**
    * Build an object (must be registered) - THIS METHOD IS DEPRECATED (Use create<T>())
    * @param obj_name Type of the object being constructed
@@ -312,6 +332,9 @@ public:
    */
   std::vector<std::string> getConstructedObjects() const;
 
+  /// The application that owns this Factory
+  MooseApp & app() { return _app; }
+
   ///@{
   /**
    * Allow objects to be deprecated via function call.
@@ -518,6 +518,13 @@ public:
   /// Returns whether the Application is running in check input mode
   bool checkInput() const { return _check_input; }
 
+  /**
+   * Records the time spent in a phase of the startup of this application (see StartupPhaseTimer)
+   * @param phase The name of the phase, e.g. "Moose::registerObjects"
+   * @param seconds The wall time spent in the phase
+   */
+  void addStartupTime(const std::string & phase, Real seconds);
+
   /**
    * Register the execute flags.
    */
@@ -529,6 +536,11 @@ protected:
    */
   static void registerExecFlag(const ExecFlagType & flag);
 
+  /**
+   * Prints the time spent in each phase of the startup, requested with --startup-timing
+   */
+  void printStartupTimes() const;
+
   /**
    * Whether or not this MooseApp has cached a Backup to use for restart / recovery
    */
@@ -687,6 +699,9 @@ protected:
   /// true if we want to just check the input file
   bool _check_input;
 
+  /// The name and wall time of each phase of the startup, in the order they were completed
+  std::vector<std::pair<std::string, Real>> _startup_times;
+
   /// The library, registration method and the handle to the method
   std::map<std::pair<std::string, std::string>, void *> _lib_handles;
 
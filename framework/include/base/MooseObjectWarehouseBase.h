@@ -154,6 +154,14 @@ public:
                          std::set<std::string> & unique_variables,
                          THREAD_ID tid = 0) const;
 
+  /**
+   * Populates the sets of subdomains and boundaries that have active objects, these are the
+   * only parts of the mesh that a loop over the block and boundary objects needs to visit.
+   */
+  void activeDomainsCovered(std::set<SubdomainID> & subdomains,
+                            std::set<BoundaryID> & boundaries,
+                            THREAD_ID tid = 0) const;
+
 protected:
   /// Convenience member storing the number of threads used for storage (1 or libMesh::n_threads)
   const THREAD_ID _num_threads;
@@ -613,6 +621,23 @@ MooseObjectWarehouseBase<T>::subdomainsCovered(std::set<SubdomainID> & subdomain
     subdomains_covered.insert(object_pair.first);
 }
 
+template <typename T>
+void
+MooseObjectWarehouseBase<T>::activeDomainsCovered(std::set<SubdomainID> & subdomains,
+                                                  std::set<BoundaryID> & boundaries,
+                                                  THREAD_ID tid /*=0*/) const
+{
+  checkThreadID(tid);
+
+  for (const auto & object_pair : _active_block_objects[tid])
+    if (!object_pair.second.empty())
+      subdomains.insert(object_pair.first);
+
+  for (const auto & object_pair : _active_boundary_objects[tid])
+    if (!object_pair.second.empty())
+      boundaries.insert(object_pair.first);
+}
+
 template <typename T>
 void
 MooseObjectWarehouseBase<T>::sortHelper(std::vector<std::shared_ptr<T>> & objects)
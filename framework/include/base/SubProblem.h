@@ -68,6 +68,14 @@ public:
    */
   virtual void useFECache(bool fe_cache) = 0;
 
+  /**
+   * Whether or not this problem should share the reference shape functions between affine
+   * elements.
+   *
+   * @param share_affine_fe True for sharing false for not.
+   */
+  virtual void shareAffineFE(bool share_affine_fe) = 0;
+
   virtual void solve() = 0;
   virtual bool converged() = 0;
 
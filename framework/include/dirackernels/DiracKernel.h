@@ -147,6 +147,25 @@ protected:
    */
   const Elem * addPoint(Point p, unsigned id = libMesh::invalid_uint);
 
+  /**
+   * Adds a batch of points where this DiracKernel needs to be evaluated.
+   *
+   * This is equivalent to calling addPoint(Point, id) for each point, but the
+   * points that need a search are located together with a single parallel
+   * reduction, rather than several reductions per point.  When ids are
+   * supplied, the Elem containing each point is cached and reused on
+   * subsequent calls until the point moves out of it or the mesh changes.
+   * Like addPoint(Point, id), this must be called with the same points on
+   * every processor.
+   *
+   * @param points The physical x,y,z points
+   * @param elems The Elem containing each point, NULL if it is not local
+   * @param ids User-defined IDs for the points, either empty or one per point
+   */
+  void addPointBatch(const std::vector<Point> & points,
+                     std::vector<const Elem *> & elems,
+                     const std::vector<unsigned> & ids = std::vector<unsigned>());
+
   /**
    * Returns the user-assigned ID of the current Dirac point if it
    * exits, and libMesh::invalid_uint otherwise.  Can be used e.g. in
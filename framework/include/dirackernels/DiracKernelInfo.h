@@ -88,6 +88,20 @@ public:
    */
   const Elem * findPoint(Point p, const MooseMesh & mesh);
 
+  /**
+   * Determines the Elem in which each of the Points resides, equivalent to calling
+   * findPoint() for each Point but with a single parallel reduction for all of them.
+   * This is a parallel_only() function, it must be called with the same Points on
+   * every processor.
+   * @param points The Points to locate
+   * @param elems The Elem containing each Point, NULL if it was not found or another
+   *              processor is responsible for it
+   * @param mesh The mesh to search
+   */
+  void findPoints(const std::vector<Point> & points,
+                  std::vector<const Elem *> & elems,
+                  const MooseMesh & mesh);
+
 protected:
   /**
    * Check if two points are equal with respect to a tolerance
@@ -273,6 +273,12 @@ public:
    */
   void meshChanged();
 
+  /**
+   * The number of times meshChanged() has been called, clients that cache data computed from
+   * the mesh compare it with the value they saw when the data was computed.
+   */
+  unsigned int meshChangedCount() const { return _mesh_changed_count; }
+
   /**
    * Declares a callback function that is executed at the conclusion
    * of meshChanged(). Ther user can implement actions required after
@@ -333,6 +339,17 @@ public:
   StoredRange<MooseMesh::const_bnd_node_iterator, const BndNode *> * getBoundaryNodeRange();
   StoredRange<MooseMesh::const_bnd_elem_iterator, const BndElement *> * getBoundaryElementRange();
 
+  /**
+   * Return a range of the active local elements that are either in one of the supplied
+   * subdomains or have a side on one of the supplied boundaries. The elements are grouped by
+   * subdomain and the range is cached, so repeated calls with the same ids are cheap. If the
+   * restricted range would contain every active local element the full range is returned.
+   * @param subdomains The subdomains whose elements are included
+   * @param boundaries The boundaries whose elements are included
+   */
+  ConstElemRange * getActiveLocalElementRange(const std::set<SubdomainID> & subdomains,
+                                              const std::set<BoundaryID> & boundaries);
+
   /**
    * Returns a read-only reference to the set of subdomains currently
    * present in the Mesh.
@@ -822,6 +839,18 @@ public:
    */
   virtual std::unique_ptr<PointLocatorBase> getPointLocator() const;
 
+  /**
+   * Flag this mesh as only partially displaced, i.e. some of its nodes still hold the positions
+   * of a previous displacement. Point locators cannot be built while this flag is set.
+   */
+  void setPartiallyDisplaced(bool partially_displaced)
+  {
+    _partially_displaced = partially_displaced;
+  }
+
+  /// Whether only some of the nodes of this mesh hold their current displaced positions
+  bool isPartiallyDisplaced() const { return _partially_displaced; }
+
 protected:
   std::vector<std::unique_ptr<GhostingFunctor>> _ghosting_functors;
 
@@ -866,6 +895,9 @@ protected:
   /// true if mesh is changed (i.e. after adaptivity step)
   bool _is_changed;
 
+  /// The number of times meshChanged() has been called
+  unsigned int _mesh_changed_count;
+
   /// True if a Nemesis Mesh was read in
   bool _is_nemesis;
 
@@ -897,6 +929,14 @@ protected:
    */
   std::unique_ptr<ConstElemRange> _active_local_elem_range;
 
+  /// The active local elements of each subdomain, used to build the restricted element ranges
+  std::map<SubdomainID, std::vector<Elem *>> _active_local_subdomain_elems;
+
+  /// The restricted element ranges along with the elements that they are built from
+  std::map<std::pair<std::set<SubdomainID>, std::set<BoundaryID>>,
+           std::pair<std::vector<Elem *>, std::unique_ptr<ConstElemRange>>>
+      _restricted_active_local_elem_ranges;
+
   std::unique_ptr<SemiLocalNodeRange> _active_semilocal_node_range;
   std::unique_ptr<NodeRange> _active_node_range;
   std::unique_ptr<ConstNodeRange> _local_node_range;
@@ -981,6 +1021,9 @@ protected:
   /// Boolean indicating whether this mesh was detected to be regular and orthogonal
   bool _regular_orthogonal_mesh;
 
+  /// Whether only some of the nodes hold their current displaced positions (lazy displacement)
+  bool _partially_displaced;
+
   /// The bounds in each dimension of the mesh for regular orthogonal meshes
   std::vector<std::vector<Real>> _bounds;
 
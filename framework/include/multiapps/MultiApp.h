@@ -18,6 +18,9 @@
 #include "SetupInterface.h"
 #include "Restartable.h"
 
+// C++ includes
+#include <functional>
+
 class MultiApp;
 class UserObject;
 class FEProblemBase;
@@ -248,6 +251,12 @@ public:
    */
   virtual void moveApp(unsigned int global_app, Point p);
 
+  /**
+   * The number of times apps have been reset, moved, or rebalanced between processors. Transfers
+   * that cache the mapping between the master and the apps rebuild it when this changes.
+   */
+  unsigned int appsChangedCount() const { return _apps_changed_count; }
+
   /**
    * For apps outputting in position we need to change their output positions
    * if their parent app moves.
@@ -266,6 +275,14 @@ public:
    */
   bool isRootProcessor() { return _my_rank == 0; }
 
+  /**
+   * Sets the range of apps owned by this processor. This must be called before the apps are
+   * created, it is used to recover the apps of a MultiApp that were moved by rebalanceApps().
+   * @param first_local_app The global number of the first app on this processor
+   * @param num_local_apps The number of apps on this processor
+   */
+  void setLocalApps(unsigned int first_local_app, unsigned int num_local_apps);
+
 protected:
   /**
    * _must_ fill in _positions with the positions of the sub-aps
@@ -299,6 +316,47 @@ protected:
   /// call back executed right before app->runInputFile()
   virtual void preRunInputFile();
 
+  /**
+   * Calls solve_app with the local number of each local app, solving up to
+   * 'max_concurrent_apps' of them at once.
+   *
+   * The screen output of apps solved concurrently is collected and written in the order of
+   * the apps once they are all solved. Likewise, an exception thrown while solving an app is
+   * rethrown (in the order of the apps) after all of the apps are solved.
+   *
+   * @param solve_app The function that solves a single local app
+   */
+  void solveLocalApps(const std::function<void(unsigned int)> & solve_app);
+
+  /**
+   * Moves apps between the processors so that the solve time measured by solveLocalApps() since
+   * the last call is balanced. Each processor keeps a contiguous range of at least one app. An
+   * app that moves is backed up on its old processor and restored on its new processor, along
+   * with its Picard backup.
+   *
+   * This is collective on the processors of the MultiApp. It does nothing unless there are at
+   * least as many apps as processors, so that every app runs on a single processor.
+   *
+   * @param tolerance The apps are only moved if the largest solve time of a processor is
+   * expected to drop by more than this fraction
+   */
+  void rebalanceApps(Real tolerance);
+
+  /**
+   * Called by rebalanceApps() once the apps that moved to this processor are created and before
+   * they are restored.
+   * @param created Whether each local app was created on this processor
+   */
+  virtual void localAppsChanged(const std::vector<bool> & /*created*/) {}
+
+  /**
+   * The stream for messages about a local app written while it is being solved. This is the
+   * console of the app when apps are solved concurrently, otherwise it is the console of this
+   * object.
+   * @param local_app The local app number
+   */
+  const ConsoleStream & localAppConsole(unsigned int local_app);
+
   /**
    * Initialize the MultiApp by creating the provided number of apps.
    *
@@ -360,6 +418,18 @@ protected:
   /// Maximum number of processors to give to each app
   unsigned int _max_procs_per_app;
 
+  /// Maximum number of local apps to solve at once
+  unsigned int _max_concurrent_apps;
+
+  /// Communicators for each local app, these are duplicates of _my_comm when solving concurrently
+  std::vector<MPI_Comm> _app_comms;
+
+  /// True while the local apps are being solved concurrently
+  bool _solving_concurrently;
+
+  /// The time spent solving each local app since the last call to rebalanceApps()
+  std::vector<Real> _app_solve_times;
+
   /// Whether or not to move the output of the MultiApp into position
   bool _output_in_position;
 
@@ -384,6 +454,9 @@ protected:
   /// Whether or not the move has happened
   bool _move_happened;
 
+  /// The number of times apps have been reset, moved, or rebalanced
+  unsigned int _apps_changed_count;
+
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
 
@@ -402,6 +475,12 @@ dataStore(std::ostream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error storing std::vector<Backup*>");
 
+  // The apps may have been moved by MultiApp::rebalanceApps()
+  unsigned int first_local_app = multi_app->firstLocalApp();
+  unsigned int num_local_apps = backups.size();
+  dataStore(stream, first_local_app, context);
+  dataStore(stream, num_local_apps, context);
+
   for (unsigned int i = 0; i < backups.size(); i++)
     dataStore(stream, backups[i], context);
 }
@@ -415,6 +494,12 @@ dataLoad(std::istream & stream, SubAppBackups & backups, void * context)
   if (!multi_app)
     mooseError("Error loading std::vector<Backup*>");
 
+  unsigned int first_local_app = 0;
+  unsigned int num_local_apps = 0;
+  dataLoad(stream, first_local_app, context);
+  dataLoad(stream, num_local_apps, context);
+  multi_app->setLocalApps(first_local_app, num_local_apps);
+
   for (unsigned int i = 0; i < backups.size(); i++)
     dataLoad(stream, backups[i], context);
 
@@ -16,6 +16,9 @@
 
 #include "MultiApp.h"
 
+// C++ includes
+#include <atomic>
+
 // Forward declarations
 class TransientMultiApp;
 class Transient;
@@ -51,6 +54,9 @@ public:
    */
   Real computeDT();
 
+protected:
+  virtual void localAppsChanged(const std::vector<bool> & created) override;
+
 private:
   /**
    * Setup the executioner for the local app.
@@ -60,6 +66,17 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0);
 
+  /**
+   * Solve a single local app up to the target time, this may be called concurrently for
+   * different apps (see MultiApp::solveLocalApps).
+   *
+   * @param i The local app number for the app to solve.
+   * @param dt The master time step
+   * @param target_time The global time the app is solved to
+   * @param auto_advance Whether or not the app is advanced after the solve
+   */
+  void solveApp(unsigned int i, Real dt, Real target_time, bool auto_advance);
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -71,7 +88,7 @@ private:
   unsigned int _max_failures;
   bool _tolerate_failure;
 
-  unsigned int _failures;
+  std::atomic<unsigned int> _failures;
 
   bool _catch_up;
   Real _max_catch_up_steps;
@@ -93,6 +110,15 @@ private:
 
   /// Flag for toggling console output on sub cycles
   bool _print_sub_cycles;
+
+  /// Number of solves between moving Apps to balance the processors (0 to never move them)
+  const unsigned int _rebalance_interval;
+
+  /// Fraction the largest processor solve time must drop by for the Apps to be moved
+  const Real _rebalance_tolerance;
+
+  /// Number of times solveStep() has been called
+  unsigned int _num_solves;
 };
 
 /**
@@ -0,0 +1,156 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef BINARYTIMESERIES_H
+#define BINARYTIMESERIES_H
+
+// MOOSE includes
+#include "AdvancedOutput.h"
+
+// C++ includes
+#include <fstream>
+
+// Forward declarations
+class BinaryTimeSeries;
+
+template <>
+InputParameters validParams<BinaryTimeSeries>();
+
+/**
+ * Appends postprocessor, scalar variable, and VectorPostprocessor data to a single binary file.
+ *
+ * The file is a sequence of 8-byte aligned blocks written in the native byte order. It begins
+ * with the magic string "MOOSEBTS" followed by the format version as a uint64. Each block starts
+ * with a 16-byte header (uint32 block type, uint32 series id, uint64 payload size in bytes):
+ *
+ * Schema block (type 0): uint32 kind (0 = postprocessors and scalars, 1 = VectorPostprocessor),
+ *   uint32 number of columns, and the series name followed by the column names, each stored as
+ *   a uint32 length and the characters. A schema block precedes the first data block of a
+ *   series and is repeated (with a new id) whenever the columns of the series change.
+ *
+ * Data block (type 1): float64 time and int64 time step, then for kind 0 one float64 per
+ *   column and for kind 1 a uint64 length per column followed by the values of each column.
+ *
+ * The block headers act as the index of the file, they may be walked without reading the data,
+ * which is then loaded directly as arrays (see python/mooseutils/BinaryTimeSeriesReader.py).
+ */
+class BinaryTimeSeries : public AdvancedOutput
+{
+public:
+  BinaryTimeSeries(const InputParameters & parameters);
+
+  /**
+   * The filename for the output file
+   * @return A string of output file including the extension
+   */
+  virtual std::string filename() override;
+
+protected:
+  /**
+   * Opens the file, when recovering the file is truncated to the size stored with the
+   * recovery data so that blocks written after the checkpoint are discarded.
+   */
+  virtual void initialSetup() override;
+
+  /**
+   * Gathers the postprocessor and scalar values and writes them as a single row
+   */
+  virtual void output(const ExecFlagType & type) override;
+
+  /**
+   * Adds the postprocessor values to the current row
+   */
+  virtual void outputPostprocessors() override;
+
+  /**
+   * Adds the scalar variable values to the current row
+   *
+   * If an aux variable contains multiple components the output name for the
+   * variable is appended with the component number (e.g., aux_0, aux_1, ...)
+   */
+  virtual void outputScalarVariables() override;
+
+  /**
+   * Writes a data block for each VectorPostprocessor
+   */
+  virtual void outputVectorPostprocessors() override;
+
+private:
+  /// The kinds of series that may be stored in the file
+  enum class SeriesKind : uint32_t
+  {
+    POSTPROCESSOR = 0,
+    VECTOR_POSTPROCESSOR = 1
+  };
+
+  /// The types of blocks that may be stored in the file
+  enum class BlockType : uint32_t
+  {
+    SCHEMA = 0,
+    DATA = 1
+  };
+
+  /**
+   * Returns the id of the series with the supplied name and columns, a schema block is written
+   * if the series does not exist or if its columns have changed.
+   */
+  uint32_t seriesId(SeriesKind kind,
+                    const std::string & name,
+                    const std::vector<std::string> & columns);
+
+  /**
+   * Writes the header of a block
+   */
+  void writeBlockHeader(BlockType type, uint32_t id, uint64_t payload_size);
+
+  /**
+   * Writes the time and time step that begin each data block
+   */
+  void writeDataBlockTime();
+
+  /**
+   * Writes the raw bytes of a value to the file
+   */
+  template <typename T>
+  void write(const T & value)
+  {
+    _stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  /**
+   * Writes a string as its length followed by the characters
+   */
+  void writeString(const std::string & str);
+
+  /// The output file stream, only open on processor zero
+  std::ofstream _stream;
+
+  /// The id and columns of each series written to the file
+  std::map<std::pair<SeriesKind, std::string>, std::pair<uint32_t, std::vector<std::string>>>
+      _series;
+
+  /// The id assigned to the next schema block
+  uint32_t _next_series_id;
+
+  /// The names of the postprocessors and scalars in the current row
+  std::vector<std::string> _row_names;
+
+  /// The values of the postprocessors and scalars in the current row
+  std::vector<Real> _row_values;
+
+  /// The size of the file after the last output, used to discard data on recover
+  uint64_t & _file_size;
+};
+
+#endif /* BINARYTIMESERIES_H */
@@ -191,6 +191,19 @@ public:
     _buffer_action_console_outputs = buffer;
   }
 
+  /**
+   * Collect the screen output of this application rather than writing it to the screen, this
+   * is used while MultiApp sub-apps are solved concurrently (see MultiApp::solveLocalApps)
+   * @param capture True to begin collecting, false to write the collected output and stop
+   */
+  void captureScreenOutput(bool capture);
+
+  /**
+   * The stream that the Console objects write to
+   * @return Moose::out, or the stream collecting the output if it is being captured
+   */
+  std::ostream & screenStream();
+
   /// Sets a Boolean indicating that at least one object is requesting performance logging in this application
   void setLoggingRequested() { _logging_requested = true; }
 
@@ -350,6 +363,12 @@ private:
   /// Indicates that performance logging has been requested by the console or some object (PerformanceData)
   bool _logging_requested;
 
+  /// True when the screen output is being collected (@see captureScreenOutput)
+  bool _capture_screen_output;
+
+  /// The collected screen output
+  std::ostringstream _captured_screen_output;
+
   // Allow complete access:
   // FEProblemBase for calling initial, timestepSetup, outputStep, etc. methods
   friend class FEProblemBase;
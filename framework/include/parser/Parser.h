@@ -25,6 +25,8 @@
 
 #include <vector>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
 
 // Forward declarations
 class ActionWarehouse;
@@ -176,6 +178,27 @@ public:
   std::vector<std::string> listValidParams(std::string & section_name);
 
 protected:
+  /// Function that sets a parameter of a particular type from the input file or command line
+  typedef void (*ParamSetter)(Parser & parser,
+                              const std::string & full_name,
+                              const std::string & short_name,
+                              libMesh::Parameters::Value * param,
+                              bool in_global,
+                              GlobalParamsAction * global_block);
+
+  /**
+   * The setter of each supported parameter type, keyed on the type of the
+   * InputParameters::Parameter object.  This replaces a chain of type comparisons for every
+   * extracted parameter with a single lookup.
+   */
+  static const std::unordered_map<std::type_index, ParamSetter> & paramSetters();
+
+  /**
+   * Returns the section or parameter node with the supplied full path, or nullptr if it does not
+   * exist.  The lookup uses the index of the tree built by parse().
+   */
+  hit::Node * findNode(const std::string & path) const;
+
   /**
    * Helper functions for setting parameters of arbitrary types - bodies are in the .C file
    * since they are called only from this Object
@@ -263,6 +286,9 @@ protected:
   std::unique_ptr<hit::Node> _root = nullptr;
   std::vector<std::string> _secs_need_first;
 
+  /// The sections and parameters of the merged input tree, keyed on their full paths
+  std::unordered_map<std::string, hit::Node *> _node_index;
+
   /// The MooseApp this Parser is part of
   MooseApp & _app;
   /// The Factory associated with that MooseApp
@@ -20,6 +20,11 @@
 
 #include "libmesh/preconditioner.h"
 #include "libmesh/linear_implicit_system.h"
+#include "libmesh/petsc_macro.h"
+
+#ifdef LIBMESH_HAVE_PETSC
+#include <petscvec.h>
+#endif
 
 // C++ includes
 #include <vector>
@@ -76,6 +81,32 @@ public:
   virtual void setup();
 
 protected:
+  /**
+   * Build the maps between the dofs of each variable in the nonlinear system and the dofs
+   * of its preconditioning system. The maps only depend on the mesh, so they are rebuilt
+   * when the mesh changes rather than in every call to apply().
+   */
+  void buildDofMaps();
+
+  /// Release the scatters between the nonlinear system and the preconditioning systems
+  void destroyScatters();
+
+  /**
+   * Copy the values of a variable in a nonlinear system vector to a vector of its
+   * preconditioning system
+   */
+  void copyToSystem(unsigned int var,
+                    const NumericVector<Number> & from,
+                    NumericVector<Number> & to);
+
+  /**
+   * Copy the values in a vector of the preconditioning system of a variable to a nonlinear
+   * system vector
+   */
+  void copyFromSystem(unsigned int var,
+                      const NumericVector<Number> & from,
+                      NumericVector<Number> & to);
+
   /// The nonlinear system this PBP is associated with (convenience reference)
   NonlinearSystemBase & _nl;
   /// List of linear system that build up the preconditioner
@@ -97,6 +128,23 @@ protected:
    * to keep looking this thing up through it's name.
    */
   std::vector<std::vector<SparseMatrix<Number> *>> _off_diag_mats;
+
+  /// The value of MooseMesh::meshChangedCount() when the dof maps were built
+  unsigned int _dof_maps_mesh_changed_count;
+
+  /// The local dofs of each variable in the nonlinear system
+  std::vector<std::vector<numeric_index_type>> _nl_dofs;
+
+  /// The dofs in the preconditioning system of each variable, in the same order as _nl_dofs
+  std::vector<std::vector<numeric_index_type>> _system_dofs;
+
+  /// The sum of the off-diagonal blocks of each system applied to the coupled solutions
+  std::vector<std::unique_ptr<NumericVector<Number>>> _off_diag_products;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// Scatters from the nonlinear system to each preconditioning system (reversed to copy back)
+  std::vector<VecScatter> _scatters;
+#endif
 };
 
 #endif // PHYSICSBASEDPRECONDITIONER_H
@@ -27,7 +27,9 @@ template <>
 InputParameters validParams<MultiAppInterpolationTransfer>();
 
 /**
- * Copy the value to the target domain from the nearest node in the source domain.
+ * Interpolates the values of the source variables in the source domain to the target domain.
+ * All of the variables are interpolated from the same source points, so the source variables
+ * must all be nodal or all be elemental, and likewise for the target variables.
  */
 class MultiAppInterpolationTransfer : public MultiAppTransfer
 {
@@ -52,13 +54,45 @@ protected:
                         const MeshBase::const_node_iterator & nodes_begin,
                         const MeshBase::const_node_iterator & nodes_end);
 
-  AuxVariableName _to_var_name;
-  VariableName _from_var_name;
+  /**
+   * Adds the source points and the values of all of the source variables at them to the
+   * interpolation object, the values of each point are packed together
+   */
+  void addSourceValues(FEProblemBase & from_problem,
+                       const Point & position,
+                       std::vector<Point> & src_pts,
+                       std::vector<Number> & src_vals);
+
+  /**
+   * Finds the target dofs of all of the target variables and the points at which they are
+   * interpolated
+   * @param to_problem The target problem
+   * @param position The position of the target app
+   * @param dofs The dofs, those of point i are [i * n_vars, (i + 1) * n_vars), invalid_id where
+   * a variable has no dofs at the point
+   * @param pts The points
+   */
+  void findTargets(FEProblemBase & to_problem,
+                   const Point & position,
+                   std::vector<dof_id_type> & dofs,
+                   std::vector<Point> & pts);
+
+  std::vector<AuxVariableName> _to_var_name;
+  std::vector<VariableName> _from_var_name;
 
   unsigned int _num_points;
   Real _power;
   MooseEnum _interp_type;
   Real _radius;
+
+  /// Whether the target dofs and points are cached
+  bool _points_cached;
+
+  /// The dofs of the variables in each target app, packed per point
+  std::vector<std::vector<dof_id_type>> _cached_dofs;
+
+  /// The points at which the dofs are interpolated, in the frame of the source
+  std::vector<std::vector<Point>> _cached_points;
 };
 
 #endif /* MULTIAPPINTERPOLATIONTRANSFER_H */
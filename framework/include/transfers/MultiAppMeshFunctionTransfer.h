@@ -24,10 +24,10 @@ template <>
 InputParameters validParams<MultiAppMeshFunctionTransfer>();
 
 /**
- * Transfers a vector of variables. For each individual one,
- * samples the variable's value in the Master domain at the point where
- * the MultiApp is. Copies that value into a postprocessor in the MultiApp.
- * The source and destination vectors (of variables) should be ordered consistently.
+ * Transfers a vector of variables. Samples the values of the source variables in the "from"
+ * domains at the target nodes or element centroids. The target points are located once for all
+ * of the variables and the values of all of them are exchanged in a single message per pair of
+ * processors. The source and destination vectors (of variables) should be ordered consistently.
  */
 class MultiAppMeshFunctionTransfer : public MultiAppTransfer
 {
@@ -49,16 +49,34 @@ protected:
 
 private:
   /**
-   * Performs the transfer for the variable of index i
+   * Finds the processors whose "from" bounding boxes contain the target nodes or elements of any
+   * of the variables, and the points to send to each of them
    */
-  void transferVariable(unsigned int i);
+  void findPoints(std::vector<std::vector<Point>> & outgoing_points,
+                  std::vector<BoundingBox> & local_bboxes);
+
+  /**
+   * Sets the values of the variable of index i from the values received from each processor
+   * @param incoming_vals The values received from each processor, packed per point
+   * @param n_vals The number of values per point
+   */
+  void setValues(unsigned int i,
+                 const std::vector<std::vector<Real>> & incoming_vals,
+                 unsigned int n_vals);
 
   /// To send points to other processors
-  std::vector<std::vector<Parallel::Request>> _send_points;
-  /// To send values to other processors
-  std::vector<std::vector<Parallel::Request>> _send_evals;
-  /// To send app ids to other processors
-  std::vector<std::vector<Parallel::Request>> _send_ids;
+  std::vector<Parallel::Request> _send_points;
+  /// To send values (and app ids) to other processors
+  std::vector<Parallel::Request> _send_vals;
+
+  /// The index of each target node in the points sent to each processor
+  std::vector<std::map<std::pair<unsigned int, dof_id_type>, unsigned int>> _node_index_maps;
+  /// The index of each target element in the points sent to each processor
+  std::vector<std::map<std::pair<unsigned int, dof_id_type>, unsigned int>> _elem_index_maps;
+  /// The evaluations of the points received from each processor
+  std::vector<CachedEvaluations> _cached_evaluations;
+  /// Whether the points and their evaluations are cached
+  bool _mapping_cached;
 };
 
 #endif /* MULTIAPPMESHFUNCTIONTRANSFER_H */
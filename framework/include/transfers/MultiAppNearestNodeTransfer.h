@@ -25,7 +25,9 @@ template <>
 InputParameters validParams<MultiAppNearestNodeTransfer>();
 
 /**
- * Copy the value to the target domain from the nearest node in the source domain.
+ * Copy the values to the target domain from the nearest node in the source domain. The nearest
+ * nodes are found once for all of the variables and the values of all of them are exchanged in
+ * a single message per pair of processors.
  */
 class MultiAppNearestNodeTransfer : public MultiAppTransfer
 {
@@ -69,11 +71,14 @@ protected:
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
-  AuxVariableName _to_var_name;
-  VariableName _from_var_name;
+  /**
+   * Return the local target nodes of the "to" problem i_to, limited to the target boundary if
+   * one is given
+   */
+  void getTargetLocalNodes(unsigned int i_to, std::vector<Node *> & target_local_nodes);
 
-  /// If true then node connections will be cached
-  bool _fixed_meshes;
+  std::vector<AuxVariableName> _to_var_name;
+  std::vector<VariableName> _from_var_name;
 
   /// Used to cache nodes
   std::map<dof_id_type, Node *> & _node_map;
@@ -84,6 +89,7 @@ protected:
   // These variables allow us to cache nearest node info
   bool & _neighbors_cached;
   std::vector<std::vector<unsigned int>> & _cached_froms;
+  /// The dofs of the nearest nodes, packed per point for all of the variables
   std::vector<std::vector<dof_id_type>> & _cached_dof_ids;
   std::map<dof_id_type, unsigned int> & _cached_from_inds;
   std::map<dof_id_type, unsigned int> & _cached_qp_inds;
@@ -62,10 +62,14 @@ protected:
   friend void assemble_l2(EquationSystems & es, const std::string & system_name);
 
   // These variables allow us to cache qps for fixed meshes.
-  bool _fixed_meshes;
   bool _qps_cached;
-  std::vector<std::vector<Point>> _cached_qps;
+  std::vector<CachedEvaluations> _cached_evaluations;
   std::vector<std::map<std::pair<unsigned int, unsigned int>, unsigned int>> _cached_index_map;
+
+  /// The processor and index of the incoming evaluation used at each qp with an evaluation
+  std::vector<std::vector<std::pair<processor_id_type, unsigned int>>> _final_eval_sources;
+  /// The index of the first qp of each element in _final_eval_sources
+  std::vector<std::map<dof_id_type, unsigned int>> _trimmed_element_maps;
 };
 
 #endif /* MULTIAPPPROJECTIONTRANSFER_H */
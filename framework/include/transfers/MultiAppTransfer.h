@@ -110,6 +110,69 @@ protected:
 
   // Given local app index, returns global app index.
   std::vector<unsigned int> _local2global_map;
+
+  /// If true then the mapping between the source and target meshes may be cached
+  const bool _fixed_meshes;
+
+  /**
+   * Returns true if a mesh has changed or an app has been moved, reset, or rebalanced since
+   * recordMappingState() was last called, in which case a cached mapping must be rebuilt.
+   * This is collective, every processor gets the same answer.
+   */
+  bool mappingChanged();
+
+  /**
+   * Records the state of the meshes and apps that the cached mapping was built for
+   */
+  void recordMappingState();
+
+  /**
+   * The dof indices and shape function values that evaluate source variables at a set of
+   * points, so that with fixed_meshes the points are only located once.
+   */
+  struct CachedEvaluations
+  {
+    /// The local "from" app containing each point, invalid_uint if no app contains it
+    std::vector<unsigned int> froms;
+    /// The entries of point i in dofs[v] and weights[v] are [offsets[v][i], offsets[v][i + 1])
+    std::vector<std::vector<unsigned int>> offsets;
+    std::vector<std::vector<dof_id_type>> dofs;
+    std::vector<std::vector<Real>> weights;
+  };
+
+  /**
+   * Locates each point in the lowest local "from" app whose bounding box contains it and caches
+   * the dof indices and shape function values of each of the source variables there.
+   * @param points The points, in the frame of the master app
+   * @param local_bboxes The bounding boxes of the local "from" apps
+   * @param var_names The source variables
+   * @param cache The evaluations to build
+   */
+  void cacheEvaluations(const std::vector<Point> & points,
+                        const std::vector<BoundingBox> & local_bboxes,
+                        const std::vector<VariableName> & var_names,
+                        CachedEvaluations & cache);
+
+  /**
+   * Evaluates the source variables at the cached points with the current "from" solutions
+   * @param cache The evaluations built by cacheEvaluations()
+   * @param var_names The source variables
+   * @param evals The values of variable v at point i in entry i * var_names.size() + v,
+   * OutOfMeshValue outside of every "from" app
+   * @param app_ids The global app that gave the values at each point, when transferring from
+   * the MultiApp
+   */
+  void evaluateCached(const CachedEvaluations & cache,
+                      const std::vector<VariableName> & var_names,
+                      std::vector<Real> & evals,
+                      std::vector<unsigned int> & app_ids);
+
+private:
+  /// The mesh changed counts of the master and local apps, preceded by the apps changed count
+  std::vector<unsigned int> mappingState();
+
+  /// The state recorded by recordMappingState()
+  std::vector<unsigned int> _mapping_state;
 };
 
 #endif /* MULTIAPPTRANSFER_H */
@@ -43,6 +43,12 @@ protected:
   std::string _user_object_name;
 
   bool _displaced_target_mesh;
+
+  /// Whether the points at which the user object is evaluated are cached
+  bool _points_cached;
+
+  /// The dofs of the variable and the points at which they are evaluated for each local app
+  std::vector<std::vector<std::pair<dof_id_type, Point>>> _cached_points;
 };
 
 #endif // MULTIAPPVARIABLEVALUESAMPLEPOSTPROCESSORTRANSFER_H
@@ -35,7 +35,7 @@ public:
   virtual void initialize() override;
   virtual void execute() override;
   virtual void finalize() override;
-  virtual void threadJoin(const UserObject & y) override;
+  virtual void threadJoinRange(const UserObject & y, std::size_t begin, std::size_t end) override;
 
 protected:
   /// Value of the volume for each layer
@@ -18,6 +18,7 @@
 // MOOSE includes
 #include "Moose.h"
 #include "MooseEnum.h"
+#include "ReductionBufferInterface.h"
 
 // Forward Declarations
 class InputParameters;
@@ -41,7 +42,7 @@ InputParameters validParams<LayeredBase>();
  * partial sums for the specified number of intervals in a direction
  * (x,y,z).
  */
-class LayeredBase
+class LayeredBase : public ReductionBufferInterface
 {
 public:
   LayeredBase(const InputParameters & parameters);
@@ -71,6 +72,13 @@ public:
   virtual void finalize();
   virtual void threadJoin(const UserObject & y);
 
+  /**
+   * The layers are joined concurrently when the thread copies are joined
+   * @see ReductionBufferInterface
+   */
+  virtual std::size_t reductionBufferSize() const override { return _num_layers; }
+  virtual void threadJoinRange(const UserObject & y, std::size_t begin, std::size_t end) override;
+
 protected:
   /**
    * Set the value for a particular layer
@@ -46,6 +46,7 @@ public:
   virtual void execute() override;
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
+  virtual void threadJoinRemainder(const UserObject & y) override;
 };
 
 #endif
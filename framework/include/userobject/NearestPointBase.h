@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "ElementIntegralVariableUserObject.h"
+#include "ReductionBufferInterface.h"
 
 // Forward Declarations
 class UserObject;
@@ -53,7 +54,7 @@ nearestPointBaseValidParams()
  * closest to each one of those points.
  */
 template <typename UserObjectType>
-class NearestPointBase : public ElementIntegralVariableUserObject
+class NearestPointBase : public ElementIntegralVariableUserObject, public ReductionBufferInterface
 {
 public:
   NearestPointBase(const InputParameters & parameters);
@@ -64,6 +65,14 @@ public:
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
 
+  /**
+   * The UserObjects at each point are joined concurrently when the thread copies are joined
+   * @see ReductionBufferInterface
+   */
+  virtual std::size_t reductionBufferSize() const override { return _user_objects.size(); }
+  virtual std::size_t reductionBufferChunkSize() const override { return 1; }
+  virtual void threadJoinRange(const UserObject & y, std::size_t begin, std::size_t end) override;
+
   /**
    * Given a Point return the integral value associated with the layer
    * that point falls in for the layered average closest to that
@@ -128,10 +137,19 @@ NearestPointBase<UserObjectType>::finalize()
 template <typename UserObjectType>
 void
 NearestPointBase<UserObjectType>::threadJoin(const UserObject & y)
+{
+  threadJoinRange(y, 0, _user_objects.size());
+}
+
+template <typename UserObjectType>
+void
+NearestPointBase<UserObjectType>::threadJoinRange(const UserObject & y,
+                                                  std::size_t begin,
+                                                  std::size_t end)
 {
   auto & npla = static_cast<const NearestPointBase &>(y);
 
-  for (unsigned int i = 0; i < _user_objects.size(); i++)
+  for (auto i = begin; i < end; i++)
     _user_objects[i]->threadJoin(*npla._user_objects[i]);
 }
 
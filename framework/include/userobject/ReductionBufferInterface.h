@@ -0,0 +1,75 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef REDUCTIONBUFFERINTERFACE_H
+#define REDUCTIONBUFFERINTERFACE_H
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+// Forward declarations
+class UserObject;
+
+/**
+ * Interface for UserObjects (and VectorPostprocessors) that accumulate their partial results in
+ * per-thread buffers whose entries can be joined independently of each other, e.g. the values
+ * of each layer of a LayeredIntegral or the bins of a VolumeHistogram.
+ *
+ * Rather than calling threadJoin() with each thread copy in turn, the entries of the buffer are
+ * split into ranges that are joined concurrently, each range by a single thread. Objects with
+ * data that is not part of the buffer join it in threadJoinRemainder(), which is called
+ * serially afterwards.
+ */
+class ReductionBufferInterface
+{
+public:
+  virtual ~ReductionBufferInterface() = default;
+
+  /**
+   * The number of entries in the buffer, this must be the same for all thread copies
+   */
+  virtual std::size_t reductionBufferSize() const = 0;
+
+  /**
+   * The number of consecutive entries that are always joined by the same thread. The default
+   * is a multiple of the word size so that std::vector<bool> entries joined by different threads
+   * never share storage.
+   */
+  virtual std::size_t reductionBufferChunkSize() const { return 512; }
+
+  /**
+   * Joins the entries [begin, end) of the buffer of another thread copy of this object.
+   * This is called concurrently for disjoint ranges of the same object, so implementations
+   * must only touch the supplied entries.
+   * @param y The thread copy to join into this object
+   * @param begin The first entry to join
+   * @param end One past the last entry to join
+   */
+  virtual void threadJoinRange(const UserObject & y, std::size_t begin, std::size_t end) = 0;
+
+  /**
+   * Joins the data that is not part of the buffer, this is called serially after all of the
+   * ranges have been joined.
+   */
+  virtual void threadJoinRemainder(const UserObject & /*y*/) {}
+
+  /**
+   * Joins the buffers of the supplied thread copies into this object, which should be called in
+   * place of threadJoin() for each of the copies.
+   */
+  void parallelThreadJoin(const std::vector<const UserObject *> & copies);
+};
+
+#endif // REDUCTIONBUFFERINTERFACE_H
@@ -22,6 +22,7 @@
 
 // C++ includes
 #include <fstream>
+#include <unordered_map>
 
 // Forward declarations
 class FormattedTable;
@@ -89,6 +90,19 @@ public:
 
   void clear();
 
+  /**
+   * Limits the number of rows retained in memory. Once the table holds more than twice this
+   * number of rows, the oldest rows are discarded so that only the last "n" remain. Discarded
+   * rows can no longer be written to a file, so this is intended for screen tables that only
+   * ever display the last few rows. A value of zero (the default) retains every row.
+   */
+  void setHistoryLength(std::size_t history_length) { _history_length = history_length; }
+
+  /**
+   * The total number of rows added to the table, including any discarded by the history window.
+   */
+  std::size_t numRows() const { return _num_discarded_rows + _times.size(); }
+
   /**
    * Set whether or not to output time column.
    */
@@ -167,19 +181,51 @@ protected:
   unsigned short getTermWidth(bool use_environment) const;
 
   /**
-   * Data structure for the console table:
-   * The first part of the pair tracks the independent variable (normally time) and is associated
-   * with the second part of the table which is the map of dependent variables and their associated
-   * values.
+   * Returns the storage index of the column with the supplied name, the column is created
+   * (and filled with zeros for all existing rows) if it does not exist.
+   */
+  std::size_t addColumn(const std::string & name);
+
+  /**
+   * Appends a new row, with all values initialized to zero, for the independent variable "time".
    */
-  std::vector<std::pair<Real, std::map<std::string, Real>>> _data;
+  void addRow(Real time);
 
-  /// Alignment widths (only used if asked to print aligned to CSV output)
-  std::map<std::string, unsigned int> _align_widths;
+  /**
+   * Returns the storage indices of the columns in the order of _column_names
+   */
+  std::vector<std::size_t> columnOrder() const;
+
+  /**
+   * Data structure for the table: the independent variable (normally time) of each row
+   * held in memory. The dependent variables are stored by column in _columns.
+   */
+  std::vector<Real> _times;
+
+  /**
+   * The dependent variable values, one contiguous vector per column. Every column has the
+   * same length as _times; values that were never set are zero.
+   */
+  std::vector<std::vector<Real>> _columns;
+
+  /// Map from a column name to its index in _columns
+  std::unordered_map<std::string, std::size_t> _column_index;
+
+  /// Alignment widths for each column in _columns (only used for aligned CSV output)
+  std::vector<unsigned int> _align_widths;
+
+  /// Alignment width for the time column (only used for aligned CSV output)
+  unsigned int _time_align_width;
 
   /// The set of column names updated when data is inserted through the setter methods
   std::vector<std::string> _column_names;
 
+  /// The number of rows retained in memory (zero retains all rows), see setHistoryLength()
+  std::size_t _history_length;
+
+  /// The number of rows discarded from the front of the table by the history window
+  std::size_t _num_discarded_rows;
+
   /// The single cell width used for all columns in the table
   static const unsigned short _column_width;
 
@@ -193,7 +239,19 @@ private:
   /// Open or switch the underlying file stream to point to file_name. This is idempotent.
   void open(const std::string & file_name);
 
-  void printRow(std::pair<Real, std::map<std::string, Real>> & row_data, bool align);
+  /**
+   * Writes a single row of the table to the CSV stream
+   * @param row The index into _times/_columns of the row to write
+   * @param order The storage indices of the columns in output order (see columnOrder())
+   * @param align Whether or not to pad the values to the alignment widths
+   */
+  void printRow(std::size_t row, const std::vector<std::size_t> & order, bool align);
+
+  /**
+   * Widens the alignment widths to fit the values of all rows, starting with the row
+   * at index "begin", that have yet to be written.
+   */
+  void updateAlignWidths(std::size_t begin);
 
   /// The optional output file stream
   std::string _output_file_name;
@@ -202,8 +260,9 @@ private:
   std::ofstream _output_file;
 
   /**
-   * Keeps track of the index indicating which vector elements have been output. All items
-   * with an index less than this index have been output. Higher values have not.
+   * Keeps track of the index indicating which rows have been output. All rows with an index
+   * less than this index have been output. Higher values have not. This index counts rows
+   * discarded by the history window.
    */
   std::size_t _output_row_index;
 
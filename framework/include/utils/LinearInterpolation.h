@@ -22,6 +22,10 @@
 
 /**
  * This class interpolates values given a set of data pairs and an abscissa.
+ *
+ * The interval containing the abscissa is found with a binary search, after checking the interval
+ * found by the previous call (and the one after it).  Successive samples of a time history or
+ * of sorted abscissas therefore cost O(1) and arbitrary samples cost O(log n).
  */
 class LinearInterpolation
 {
@@ -31,7 +35,7 @@ public:
    * correspond to one and other in the same position.
    */
   LinearInterpolation(const std::vector<Real> & X, const std::vector<Real> & Y);
-  LinearInterpolation() : _x(std::vector<Real>()), _y(std::vector<Real>()) {}
+  LinearInterpolation() : _x(std::vector<Real>()), _y(std::vector<Real>()), _last_interval(0) {}
 
   virtual ~LinearInterpolation() = default;
 
@@ -42,6 +46,7 @@ public:
   {
     _x = X;
     _y = Y;
+    _last_interval = 0;
     errorCheck();
   }
 
@@ -53,6 +58,14 @@ public:
    */
   Real sample(Real x) const;
 
+  /**
+   * Samples the fit at many values of the independent variable at once, which is fastest when
+   * the values are sorted
+   * @param x The values of the independent variable
+   * @param y Upon return, the values of the dependent variable
+   */
+  void sample(const std::vector<Real> & x, std::vector<Real> & y) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the
    * dependent variable
@@ -87,9 +100,21 @@ public:
   Real range(int i) const;
 
 private:
+  /**
+   * Returns the index i of the interval with _x[i] <= x < _x[i + 1], x must lie within
+   * [_x[0], _x.back())
+   */
+  unsigned int findInterval(Real x) const;
+
   std::vector<Real> _x;
   std::vector<Real> _y;
 
+  /**
+   * The interval found by the last search. The objects that own an interpolation are duplicated
+   * per thread, so this is a per-thread hint; it is always checked before it is used.
+   */
+  mutable unsigned int _last_interval;
+
   static int _file_number;
 };
 
@@ -57,7 +57,9 @@ public:
 };
 
 /**
- * A function for setting the PETSc options in PETSc from the options supplied to MOOSE
+ * A function for setting the PETSc options in PETSc from the options supplied to MOOSE.
+ * If the problem has a PETSc options prefix, the options are added for its solver only, and
+ * the options of other problems and of the command line are left alone.
  */
 void petscSetOptions(FEProblemBase & problem);
 
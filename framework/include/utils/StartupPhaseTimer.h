@@ -0,0 +1,55 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef STARTUPPHASETIMER_H
+#define STARTUPPHASETIMER_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// C++ includes
+#include <chrono>
+
+// Forward declarations
+class MooseApp;
+
+/**
+ * Measures the wall time spent in a phase of the application startup, e.g. the registration of
+ * the objects or the syntax of a module, and records it with the MooseApp when it goes out of
+ * scope.  The recorded times are printed when the application is run with --startup-timing.
+ *
+ * {
+ *   StartupPhaseTimer timer(factory.app(), "Moose::registerObjects");
+ *   ...
+ * }
+ */
+class StartupPhaseTimer
+{
+public:
+  StartupPhaseTimer(MooseApp & app, const std::string & phase);
+
+  ~StartupPhaseTimer();
+
+private:
+  /// The application whose startup is being timed
+  MooseApp & _app;
+
+  /// The name of the phase
+  const std::string _phase;
+
+  /// The time at which the phase started
+  const std::chrono::steady_clock::time_point _start;
+};
+
+#endif // STARTUPPHASETIMER_H
@@ -16,6 +16,7 @@
 #define SPHERICALAVERAGE_H
 
 #include "ElementVectorPostprocessor.h"
+#include "ReductionBufferInterface.h"
 
 class SphericalAverage;
 
@@ -26,7 +27,7 @@ InputParameters validParams<SphericalAverage>();
  * Compute a spherical average of a variableas a function of radius throughout the
  * simulation domain.
  */
-class SphericalAverage : public ElementVectorPostprocessor
+class SphericalAverage : public ElementVectorPostprocessor, public ReductionBufferInterface
 {
 public:
   SphericalAverage(const InputParameters & parameters);
@@ -36,6 +37,13 @@ public:
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
 
+  /**
+   * The bins are joined concurrently when the thread copies are joined
+   * @see ReductionBufferInterface
+   */
+  virtual std::size_t reductionBufferSize() const override { return _nbins; }
+  virtual void threadJoinRange(const UserObject & y, std::size_t begin, std::size_t end) override;
+
 protected:
   /// compute the distance of the current quadarature point for binning
   virtual Real computeDistance();
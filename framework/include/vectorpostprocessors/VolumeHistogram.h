@@ -16,6 +16,7 @@
 #define VOLUMEHISTOGRAM_H
 
 #include "ElementVectorPostprocessor.h"
+#include "ReductionBufferInterface.h"
 
 class VolumeHistogram;
 
@@ -27,7 +28,7 @@ InputParameters validParams<VolumeHistogram>();
  * This VectorPostprocessor lets you tabulate the volumes in teh simulation domain
  * where a given variable has certain values.
  */
-class VolumeHistogram : public ElementVectorPostprocessor
+class VolumeHistogram : public ElementVectorPostprocessor, public ReductionBufferInterface
 {
 public:
   VolumeHistogram(const InputParameters & parameters);
@@ -37,6 +38,13 @@ public:
   virtual void finalize() override;
   virtual void threadJoin(const UserObject & y) override;
 
+  /**
+   * The bins are joined concurrently when the thread copies are joined
+   * @see ReductionBufferInterface
+   */
+  virtual std::size_t reductionBufferSize() const override { return _nbins; }
+  virtual void threadJoinRange(const UserObject & y, std::size_t begin, std::size_t end) override;
+
 protected:
   /// compute the volume contribution at the current quadrature point
   virtual Real computeVolume();
@@ -72,12 +72,12 @@
 
   [./riemann]
     type = CNSFVHLLCInternalSideFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./bc]
     type = CNSFVFreeOutflowBoundaryFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 []
 ############################################################
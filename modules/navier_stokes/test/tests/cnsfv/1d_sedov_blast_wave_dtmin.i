@@ -76,17 +76,17 @@
   [../]
 
   [./riemann]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVHLLCInternalSideFlux
   [../]
 
   [./free_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVFreeOutflowBoundaryFlux
   [../]
 
   [./symm_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVHLLCSlipBoundaryFlux
     bc_uo = 'symm_bcuo'
   [../]
@@ -66,12 +66,12 @@
 
   [./riemann]
     type = CNSFVHLLCInternalSideFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./free_outflow_bc]
     type = CNSFVFreeOutflowBoundaryFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 []
 ############################################################
@@ -78,13 +78,13 @@
 
   [./riemann]
     type = CNSFVHLLCInternalSideFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./bc]
     type = CNSFVHLLCSlipBoundaryFlux
     bc_uo = 'slip_bcuo'
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 []
 ############################################################
@@ -74,19 +74,19 @@
 
   [./riemann]
     type = CNSFVHLLCInternalSideFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./farfield_bc]
     type = CNSFVRiemannInvariantBoundaryFlux
     bc_uo = 'farfield_bcuo'
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./slip_bc]
     type = CNSFVHLLCSlipBoundaryFlux
     bc_uo = 'slip_bcuo'
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 []
 ############################################################
@@ -60,18 +60,18 @@
   [../]
 
   [./riemann]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVHLLCInternalSideFlux
   [../]
 
   [./farfield_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVRiemannInvariantBoundaryFlux
     bc_uo = 'farfield_bcuo'
   [../]
 
   [./slip_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVHLLCSlipBoundaryFlux
     bc_uo = 'slip_bcuo'
   [../]
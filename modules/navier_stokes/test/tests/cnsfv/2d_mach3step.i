@@ -68,25 +68,25 @@
 
   [./riemann]
     type = CNSFVHLLCInternalSideFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./wall_bc]
     type = CNSFVHLLCSlipBoundaryFlux
     bc_uo = 'wall_bcuo'
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./inflow_bc]
     type = CNSFVRiemannInvariantBoundaryFlux
     bc_uo = 'inflow_bcuo'
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./outflow_bc]
     type = CNSFVRiemannInvariantBoundaryFlux
     bc_uo = 'outflow_bcuo'
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 []
 ############################################################
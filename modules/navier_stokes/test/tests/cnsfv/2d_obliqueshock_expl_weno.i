@@ -69,24 +69,24 @@
   [../]
 
   [./riemann]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVHLLCInternalSideFlux
   [../]
 
   [./slip_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVHLLCSlipBoundaryFlux
     bc_uo = 'slip_bcuo'
   [../]
 
   [./inflow_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVFreeInflowBoundaryFlux
     bc_uo = 'inflow_bcuo'
   [../]
 
   [./outflow_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVRiemannInvariantBoundaryFlux
     bc_uo = 'outflow_bcuo'
   [../]
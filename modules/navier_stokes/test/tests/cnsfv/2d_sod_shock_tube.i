@@ -80,12 +80,12 @@
   [../]
 
   [./riemann]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVHLLCInternalSideFlux
   [../]
 
   [./free_outflow_bc]
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
     type = CNSFVFreeOutflowBoundaryFlux
   [../]
 []
@@ -10,6 +10,7 @@
 
 #include "AuxKernel.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowArray2D.h"
 
 class PorousFlowPropertyAux;
 
@@ -46,7 +47,7 @@ private:
   const MaterialProperty<std::vector<Real>> * _fluid_viscosity;
 
   /// Mass fraction of each component in each phase
-  const MaterialProperty<std::vector<std::vector<Real>>> * _mass_fractions;
+  const MaterialProperty<PorousFlowPhaseComponentArray<Real>> * _mass_fractions;
 
   /// Relative permeability of each phase
   const MaterialProperty<std::vector<Real>> * _relative_permeability;
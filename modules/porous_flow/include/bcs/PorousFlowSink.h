@@ -11,6 +11,7 @@
 #include "IntegratedBC.h"
 #include "Function.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowArray2D.h"
 
 // Forward Declarations
 class PorousFlowSink;
@@ -105,22 +106,22 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _fluid_density_node;
 
   /// d(Fluid density for each phase (at the node))/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_density_node_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dfluid_density_node_dvar;
 
   /// Viscosity of each component in each phase
   const MaterialProperty<std::vector<Real>> * const _fluid_viscosity;
 
   /// d(Viscosity of each component in each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dfluid_viscosity_dvar;
 
   /// Relative permeability of each phase
   const MaterialProperty<std::vector<Real>> * const _relative_permeability;
 
   /// d(Relative permeability of each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _drelative_permeability_dvar;
 
   /// Mass fraction of each component in each phase
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _mass_fractions;
+  const MaterialProperty<PorousFlowPhaseComponentArray<Real>> * const _mass_fractions;
 
   /// d(Mass fraction of each component in each phase)/d(PorousFlow variable)
   const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> * const _dmass_fractions_dvar;
@@ -129,13 +130,13 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _enthalpy;
 
   /// d(enthalpy of each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _denthalpy_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _denthalpy_dvar;
 
   /// Internal_Energy of each phase
   const MaterialProperty<std::vector<Real>> * const _internal_energy;
 
   /// d(internal_energy of each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dinternal_energy_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dinternal_energy_dvar;
 
   /// Thermal_Conductivity of porous material
   const MaterialProperty<RealTensorValue> * const _thermal_conductivity;
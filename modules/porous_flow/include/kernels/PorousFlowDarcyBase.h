@@ -10,6 +10,7 @@
 
 #include "Kernel.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowArray2D.h"
 
 class PorousFlowDarcyBase;
 
@@ -30,7 +31,11 @@ public:
   PorousFlowDarcyBase(const InputParameters & parameters);
 
 protected:
+  virtual void initialSetup() override;
   virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+  virtual void meshChanged() override;
   virtual Real computeQpResidual() override;
   virtual void computeResidual() override;
   virtual void computeJacobian() override;
@@ -92,19 +97,19 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density_node;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the node)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_node_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_density_node_dvar;
 
   /// Fluid density for each phase (at the qp)
   const MaterialProperty<std::vector<Real>> & _fluid_density_qp;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the qp)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_density_qp_dvar;
 
   /// Viscosity of each component in each phase
   const MaterialProperty<std::vector<Real>> & _fluid_viscosity;
 
   /// Derivative of the fluid viscosity for each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_viscosity_dvar;
 
   /// Nodal pore pressure in each phase
   const MaterialProperty<std::vector<Real>> & _pp;
@@ -113,10 +118,10 @@ protected:
   const MaterialProperty<std::vector<RealGradient>> & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dgrad_p_dgrad_var;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dgrad_p_dgrad_var;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<RealGradient>> & _dgrad_p_dvar;
 
   /// PorousFlow UserObject
   const PorousFlowDictator & _porousflow_dictator;
@@ -160,18 +165,77 @@ protected:
   std::vector<std::vector<std::vector<Real>>> _jacobian;
 
   /**
-   * Number of nonlinear iterations (in this timestep and this element)
-   * that a node is an upwind node for a given fluid phase.
-   * _num_upwinds[element_number][phase][node_number_in_element]
+   * Upwind bookkeeping and the Darcy flux (without mobility) of every active local element, in
+   * flat arrays indexed by the local element index (looked up by element id in local_index).
+   * Each element is only handled by one thread at a time, so a single ElementData is shared by
+   * all the threaded copies of this Kernel (it is owned by the thread-0 copy) without locking.
    */
-  std::unordered_map<unsigned, std::vector<std::vector<unsigned>>> _num_upwinds;
+  struct ElementData
+  {
+    /// The local element index of each active local element (indexed by element id)
+    std::vector<unsigned> local_index;
+
+    /**
+     * Number of nonlinear iterations (in this timestep and this element)
+     * that a node is an upwind node for a given fluid phase.
+     * num_upwinds[(local_index * num_phases + phase) * stride + node_number_in_element]
+     */
+    std::vector<unsigned> num_upwinds;
+
+    /**
+     * Number of nonlinear iterations (in this timestep and this element)
+     * that a node is an downwind node for a given fluid phase.
+     * num_downwinds[(local_index * num_phases + phase) * stride + node_number_in_element]
+     */
+    std::vector<unsigned> num_downwinds;
+
+    /// The value of generation when the upwind counts of each element were last zeroed
+    std::vector<unsigned> count_generation;
+
+    /// Incremented every timestep, which clears the upwind counts of all elements in O(1)
+    unsigned generation = 1;
+
+    /**
+     * The Darcy flux without mobility, which only depends on the solution, so it is shared
+     * by all the residuals and Jacobians computed at the same solution (typically the residual
+     * that ends a Newton step and the Jacobian that follows it).
+     * darcy_flux[(local_index * num_phases + phase) * stride + node_number_in_element]
+     */
+    std::vector<Real> darcy_flux;
+
+    /// The value of flux_generation when darcy_flux of each element was computed
+    std::vector<unsigned> flux_computed;
+
+    /// Incremented when the solution changes, which invalidates all of darcy_flux
+    unsigned flux_generation = 1;
+
+    /// The nonlinear and auxiliary solution values (on this processor) darcy_flux is valid for
+    std::vector<Number> flux_solution;
+
+    /// Scratch space for gathering the current solution values
+    std::vector<Number> current_solution;
+
+    /// The largest number of nodes of an element
+    unsigned stride = 0;
+  };
+
+  /// The element data owned by this copy of the Kernel
+  ElementData _own_element_data;
+
+  /// The element data used by this copy of the Kernel (owned by the thread-0 copy)
+  ElementData * _element_data;
+
+  /// Indexes and sizes the element data for the current mesh (called from the thread-0 copy)
+  void sizeElementData();
+
+  /// Marks the cached Darcy flux of every element as stale (called from the thread-0 copy)
+  void invalidateDarcyFlux();
 
   /**
-   * Number of nonlinear iterations (in this timestep and this element)
-   * that a node is an downwind node for a given fluid phase.
-   * _num_upwinds[element_number][phase][node_number_in_element]
+   * Invalidates the cached Darcy flux if the solution has changed since it was computed
+   * (called from the thread-0 copy on every processor, as the check is collective)
    */
-  std::unordered_map<unsigned, std::vector<std::vector<unsigned>>> _num_downwinds;
+  void checkDarcyFlux();
 
   /**
    * Calculate the residual or Jacobian using full upwinding
@@ -10,6 +10,7 @@
 
 #include "Kernel.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowArray2D.h"
 #include "RankTwoTensor.h"
 
 class PorousFlowDispersiveFlux;
@@ -46,10 +47,10 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density_qp;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the qp)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_density_qp_dvar;
 
   /// Gradient of mass fraction of each component in each phase
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _grad_mass_frac;
+  const MaterialProperty<PorousFlowPhaseComponentArray<RealGradient>> & _grad_mass_frac;
 
   /// Derivative of mass fraction wrt PorousFlow variables
   const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
@@ -64,10 +65,10 @@ protected:
   const MaterialProperty<std::vector<Real>> & _tortuosity;
 
   /// Derivative of tortuosity wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dtortuosity_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dtortuosity_dvar;
 
   /// Diffusion coefficients of component k in fluid phase alpha
-  const MaterialProperty<std::vector<std::vector<Real>>> & _diffusion_coeff;
+  const MaterialProperty<PorousFlowPhaseComponentArray<Real>> & _diffusion_coeff;
 
   /// Derivative of the diffusion coefficients wrt PorousFlow variables
   const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _ddiffusion_coeff_dvar;
@@ -88,13 +89,13 @@ protected:
   const MaterialProperty<std::vector<Real>> & _relative_permeability;
 
   /// Derivative of relative permeability wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _drelative_permeability_dvar;
 
   /// Viscosity of each component in each phase
   const MaterialProperty<std::vector<Real>> & _fluid_viscosity;
 
   /// Derivative of viscosity wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_viscosity_dvar;
 
   /// Permeability of porous material
   const MaterialProperty<RealTensorValue> & _permeability;
@@ -109,10 +110,10 @@ protected:
   const MaterialProperty<std::vector<RealGradient>> & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dgrad_p_dgrad_var;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dgrad_p_dgrad_var;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<RealGradient>> & _dgrad_p_dvar;
 
   /// Gravitational acceleration
   const RealVectorValue _gravity;
@@ -38,7 +38,7 @@ protected:
   virtual Real dmobility(unsigned pvar) const override;
 
   /// mass fraction of the components in the phase
-  const MaterialProperty<std::vector<std::vector<Real>>> & _mfrac;
+  const MaterialProperty<PorousFlowPhaseComponentArray<Real>> & _mfrac;
 
   /// Derivative of mass fraction wrt wrt PorousFlow variables
   const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmfrac_dvar;
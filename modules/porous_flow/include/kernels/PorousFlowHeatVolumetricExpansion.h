@@ -10,6 +10,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowArray2D.h"
 
 // Forward Declarations
 class PorousFlowHeatVolumetricExpansion;
@@ -68,19 +69,19 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _fluid_density;
 
   /// d(nodal fluid density)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dfluid_density_dvar;
 
   /// nodal fluid saturation
   const MaterialProperty<std::vector<Real>> * const _fluid_saturation_nodal;
 
   /// d(nodal fluid saturation)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dfluid_saturation_nodal_dvar;
 
   /// internal energy of the phases, evaluated at the nodes
   const MaterialProperty<std::vector<Real>> * const _energy_nodal;
 
   /// d(internal energy)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _denergy_nodal_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _denergy_nodal_dvar;
 
   /// strain rate
   const MaterialProperty<Real> & _strain_rate_qp;
@@ -10,6 +10,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowArray2D.h"
 #include "RankTwoTensor.h"
 
 // Forward Declarations
@@ -68,16 +69,16 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density;
 
   /// d(fluid density)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_density_dvar;
 
   /// fluid saturation
   const MaterialProperty<std::vector<Real>> & _fluid_saturation;
 
   /// d(fluid saturation)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_saturation_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_saturation_dvar;
 
   /// mass fraction
-  const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
+  const MaterialProperty<PorousFlowPhaseComponentArray<Real>> & _mass_frac;
 
   /// d(mass fraction)/d(porous-flow variable)
   const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
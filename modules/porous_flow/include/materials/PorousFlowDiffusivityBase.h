@@ -9,6 +9,7 @@
 #define POROUSFLOWDIFFUSIVITYBASE_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowArray2D.h"
 
 class PorousFlowDiffusivityBase;
 
@@ -28,10 +29,10 @@ protected:
   MaterialProperty<std::vector<Real>> & _tortuosity;
 
   /// Derivative of tortuosity wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dtortuosity_dvar;
+  MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dtortuosity_dvar;
 
   /// Diffusion coefficients of component k in fluid phase alpha
-  MaterialProperty<std::vector<std::vector<Real>>> & _diffusion_coeff;
+  MaterialProperty<PorousFlowPhaseComponentArray<Real>> & _diffusion_coeff;
 
   /// Derivative of the diffusion coefficients wrt PorousFlow variables
   MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _ddiffusion_coeff_dvar;
@@ -9,6 +9,7 @@
 #define POROUSFLOWEFFECTIVEFLUIDPRESSURE_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowArray2D.h"
 
 // Forward Declarations
 class PorousFlowEffectiveFluidPressure;
@@ -38,7 +39,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _porepressure_old;
 
   /// d(porepressure)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dporepressure_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dporepressure_dvar;
 
   /// quadpoint or nodal saturation of each phase
   const MaterialProperty<std::vector<Real>> & _saturation;
@@ -47,7 +48,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _saturation_old;
 
   /// d(saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dsaturation_dvar;
 
   /// computed effective fluid pressure (at quadpoints or nodes)
   MaterialProperty<Real> & _pf;
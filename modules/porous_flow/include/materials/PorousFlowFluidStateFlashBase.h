@@ -163,9 +163,9 @@ protected:
   /// Derivative of temperature wrt PorousFlow variables
   const MaterialProperty<std::vector<Real>> & _dtemperature_dvar;
   /// Mass fraction matrix
-  MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
+  MaterialProperty<PorousFlowPhaseComponentArray<Real>> & _mass_frac;
   /// Gradient of the mass fraction matrix (only defined at the qps)
-  MaterialProperty<std::vector<std::vector<RealGradient>>> * _grad_mass_frac_qp;
+  MaterialProperty<PorousFlowPhaseComponentArray<RealGradient>> * _grad_mass_frac_qp;
   /// Derivative of the mass fraction matrix with respect to the Porous Flow variables
   MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
   /// Old value of saturation
@@ -174,11 +174,11 @@ protected:
   /// Fluid density of each phase
   MaterialProperty<std::vector<Real>> & _fluid_density;
   /// Derivative of the fluid density for each phase wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_density_dvar;
   /// Viscosity of each phase
   MaterialProperty<std::vector<Real>> & _fluid_viscosity;
   /// Derivative of the fluid viscosity for each phase wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dfluid_viscosity_dvar;
 
   /// Conversion from degrees Celsius to degrees Kelvin
   const Real _T_c2k;
@@ -9,6 +9,7 @@
 #define POROUSFLOWMASSFRACTION_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowArray2D.h"
 
 // Forward Declarations
 class PorousFlowMassFraction;
@@ -27,10 +28,10 @@ public:
 
 protected:
   /// Mass fraction matrix at quadpoint or nodes
-  MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
+  MaterialProperty<PorousFlowPhaseComponentArray<Real>> & _mass_frac;
 
   /// Gradient of the mass fraction matrix at the quad points
-  MaterialProperty<std::vector<std::vector<RealGradient>>> * const _grad_mass_frac;
+  MaterialProperty<PorousFlowPhaseComponentArray<RealGradient>> * const _grad_mass_frac;
 
   /// Derivative of the mass fraction matrix with respect to the porous flow variables
   MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
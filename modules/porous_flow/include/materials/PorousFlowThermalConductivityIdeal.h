@@ -9,6 +9,7 @@
 #define POROUSFLOWTHERMALCONDUCTIVITYIDEAL_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowArray2D.h"
 
 class PorousFlowThermalConductivityIdeal;
 
@@ -52,7 +53,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _saturation_qp;
 
   /// d(Saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dsaturation_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dsaturation_qp_dvar;
 
   /// Thermal conducitivity at the qps
   MaterialProperty<RealTensorValue> & _la_qp;
@@ -9,6 +9,7 @@
 #define POROUSFLOWTOTALGRAVITATIONALDENSITYFULLYSATURATEDFROMPOROSITY_H
 
 #include "PorousFlowTotalGravitationalDensityBase.h"
+#include "PorousFlowArray2D.h"
 
 // Forward Declarations
 class PorousFlowTotalGravitationalDensityFullySaturatedFromPorosity;
@@ -44,7 +45,7 @@ protected:
   const MaterialProperty<Real> & _porosity_qp;
 
   /// d(rho_f)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drho_f_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _drho_f_qp_dvar;
 
   /// d(porosity)/d(PorousFlow variable)
   const MaterialProperty<std::vector<Real>> & _dporosity_qp_dvar;
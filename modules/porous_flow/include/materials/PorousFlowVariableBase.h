@@ -10,6 +10,7 @@
 
 #include "DerivativeMaterialInterface.h"
 #include "PorousFlowMaterial.h"
+#include "PorousFlowArray2D.h"
 
 class PorousFlowVariableBase;
 
@@ -43,31 +44,31 @@ protected:
   MaterialProperty<std::vector<Real>> & _porepressure;
 
   /// d(porepressure)/d(PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real>>> & _dporepressure_dvar;
+  MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dporepressure_dvar;
 
   /// Grad(p) at the quadpoints
   MaterialProperty<std::vector<RealGradient>> * const _gradp_qp;
 
   /// d(grad porepressure)/d(grad PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<Real>>> * const _dgradp_qp_dgradv;
+  MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dgradp_qp_dgradv;
 
   /// d(grad porepressure)/d(PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<RealGradient>>> * const _dgradp_qp_dv;
+  MaterialProperty<PorousFlowPhaseVariableArray<RealGradient>> * const _dgradp_qp_dv;
 
   /// Computed nodal or qp saturation of the phases
   MaterialProperty<std::vector<Real>> & _saturation;
 
   /// d(saturation)/d(PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+  MaterialProperty<PorousFlowPhaseVariableArray<Real>> & _dsaturation_dvar;
 
   /// Grad(s) at the quadpoints
   MaterialProperty<std::vector<RealGradient>> * const _grads_qp;
 
   /// d(grad saturation)/d(grad PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<Real>>> * const _dgrads_qp_dgradv;
+  MaterialProperty<PorousFlowPhaseVariableArray<Real>> * const _dgrads_qp_dgradv;
 
   /// d(grad saturation)/d(PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<RealGradient>>> * const _dgrads_qp_dv;
+  MaterialProperty<PorousFlowPhaseVariableArray<RealGradient>> * const _dgrads_qp_dv;
 };
 
 #endif // POROUSFLOWVARIABLEBASE_H
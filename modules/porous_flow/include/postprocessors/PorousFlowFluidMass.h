@@ -10,6 +10,7 @@
 
 #include "ElementIntegralVariablePostprocessor.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowArray2D.h"
 
 // Forward Declarations
 class PorousFlowFluidMass;
@@ -42,7 +43,7 @@ protected:
   /// Phase saturation (-)
   const MaterialProperty<std::vector<Real>> & _fluid_saturation;
   /// Mass fraction of each fluid component in each phase
-  const MaterialProperty<std::vector<std::vector<Real>>> & _mass_fraction;
+  const MaterialProperty<PorousFlowPhaseComponentArray<Real>> & _mass_fraction;
   /// Saturation threshold - only fluid mass at saturations below this are calculated
   const Real _saturation_threshold;
   /// the variable for the corresponding PorousFlowMassTimeDerivative Kernel: this provides test functions
@@ -0,0 +1,138 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef POROUSFLOWARRAY2D_H
+#define POROUSFLOWARRAY2D_H
+
+#include "MooseTypes.h"
+#include "MooseError.h"
+#include "DataIO.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * A two-index array whose entries are stored contiguously in a single buffer.
+ *
+ * The extents are set at runtime (from the PorousFlowDictator).  Arrays of up to
+ * inline_capacity entries (eg, two phases and four PorousFlow variables) are stored inline,
+ * so a material property of this type needs no heap allocation at all for each quadpoint.
+ * Larger arrays use one heap allocation of exactly the entries that are used, rather than
+ * one per row as for std::vector<std::vector<T>>, and assigning, copying and swapping the
+ * properties in MaterialPropertyStorage reuse it once the extents have been set.
+ *
+ * The entries are accessed as a[i][j], just as for a std::vector<std::vector<T>>,
+ * so code that only reads and writes entries need not change.
+ */
+template <typename T>
+class PorousFlowArray2D
+{
+public:
+  /// The number of entries that are stored inline
+  static constexpr unsigned int inline_capacity = 8;
+
+  PorousFlowArray2D() : _rows(0), _cols(0) {}
+
+  /**
+   * Sets the extents and fills every entry with value
+   * @param rows number of rows (eg, number of phases)
+   * @param cols number of columns (eg, number of PorousFlow variables)
+   * @param value the value given to every entry
+   */
+  void assign(unsigned int rows, unsigned int cols, const T & value)
+  {
+    _rows = rows;
+    _cols = cols;
+    if (rows * cols <= inline_capacity)
+    {
+      std::fill(_inline, _inline + rows * cols, value);
+      _heap.clear();
+    }
+    else
+      _heap.assign(rows * cols, value);
+  }
+
+  /// Number of rows, so that size() means the same as for a std::vector<std::vector<T>>
+  unsigned int size() const { return _rows; }
+
+  /// Number of rows
+  unsigned int rows() const { return _rows; }
+
+  /// Number of columns
+  unsigned int cols() const { return _cols; }
+
+  /// The entries of row i, which are contiguous
+  T * operator[](unsigned int i)
+  {
+    mooseAssert(i < _rows, "PorousFlowArray2D row index out of range");
+    return data() + i * _cols;
+  }
+  const T * operator[](unsigned int i) const
+  {
+    mooseAssert(i < _rows, "PorousFlowArray2D row index out of range");
+    return data() + i * _cols;
+  }
+
+  T & operator()(unsigned int i, unsigned int j) { return (*this)[i][j]; }
+  const T & operator()(unsigned int i, unsigned int j) const { return (*this)[i][j]; }
+
+private:
+  /// The entries, in row-major order
+  T * data() { return _rows * _cols <= inline_capacity ? _inline : _heap.data(); }
+  const T * data() const { return _rows * _cols <= inline_capacity ? _inline : _heap.data(); }
+
+  unsigned int _rows;
+  unsigned int _cols;
+
+  /// The entries when there are no more than inline_capacity of them
+  T _inline[inline_capacity];
+
+  /// The entries when there are more than inline_capacity of them
+  std::vector<T> _heap;
+};
+
+/**
+ * Derivatives of a quantity of each phase with respect to the PorousFlow variables,
+ * indexed as [phase][variable]
+ */
+template <typename T>
+using PorousFlowPhaseVariableArray = PorousFlowArray2D<T>;
+
+/**
+ * A quantity of each fluid component in each phase, indexed as [phase][component]
+ */
+template <typename T>
+using PorousFlowPhaseComponentArray = PorousFlowArray2D<T>;
+
+template <typename T>
+inline void
+dataStore(std::ostream & stream, PorousFlowArray2D<T> & a, void * context)
+{
+  unsigned int rows = a.rows();
+  unsigned int cols = a.cols();
+  storeHelper(stream, rows, context);
+  storeHelper(stream, cols, context);
+  for (unsigned int i = 0; i < rows; ++i)
+    for (unsigned int j = 0; j < cols; ++j)
+      storeHelper(stream, a[i][j], context);
+}
+
+template <typename T>
+inline void
+dataLoad(std::istream & stream, PorousFlowArray2D<T> & a, void * context)
+{
+  unsigned int rows = 0;
+  unsigned int cols = 0;
+  loadHelper(stream, rows, context);
+  loadHelper(stream, cols, context);
+  a.assign(rows, cols, T());
+  for (unsigned int i = 0; i < rows; ++i)
+    for (unsigned int j = 0; j < cols; ++j)
+      loadHelper(stream, a[i][j], context);
+}
+
+#endif // POROUSFLOWARRAY2D_H
@@ -26,6 +26,12 @@ InputParameters validParams<BoundaryFluxBase>();
  *      and then when it is needed, we just return the cached value.
  *
  *   2. Derived classes need to override `calcFlux` and `calcJacobian`.
+ *
+ *   3. The cache holds a slot for each side of the local elements. A side is only
+ *      visited by the thread that owns its element, so the slots are read and written
+ *      without locking. A flux is valid for the residual evaluation that filled it, and
+ *      the Jacobians are valid until the next jacobianSetup(), so this object has to be
+ *      executed on 'nonlinear'.
  */
 class BoundaryFluxBase : public GeneralUserObject
 {
@@ -35,6 +41,9 @@ public:
   virtual void execute();
   virtual void initialize();
   virtual void finalize();
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+  virtual void jacobianSetup() override;
 
   /**
    * Get the boundary flux vector
@@ -91,17 +100,35 @@ public:
                             DenseMatrix<Real> & jac1) const = 0;
 
 protected:
-  mutable unsigned int _cached_side_id;
-  mutable dof_id_type _cached_elem_id;
+  /// Cached flux and Jacobian of a boundary side
+  struct SideData
+  {
+    /// residual evaluation at which the flux was computed
+    unsigned int flux_evaluation;
+    /// Jacobian evaluation at which the Jacobian was computed
+    unsigned int jacobian_evaluation;
+    /// flux vector of this side
+    std::vector<Real> flux;
+    /// Jacobian matrix of this side
+    DenseMatrix<Real> jac1;
+  };
 
-  /// Threaded storage for fluxes
-  mutable std::vector<std::vector<Real>> _flux;
+  /// Sizes the cache from the local elements of the mesh, this is called serially
+  void sizeSideData();
 
-  /// Threaded storage for jacobians
-  mutable std::vector<DenseMatrix<Real>> _jac1;
+  /**
+   * Get the cache slot of a side
+   * @param[in]   iside     local  index of current side
+   * @param[in]   ielem     global index of the current element
+   */
+  SideData & sideData(unsigned int iside, dof_id_type ielem) const;
 
-private:
-  static Threads::spin_mutex _mutex;
+  /// Index of the first slot of each element, indexed by the element id
+  std::vector<unsigned int> _elem_offset;
+  /// Slots for the sides of the local elements
+  mutable std::vector<SideData> _side_data;
+  /// Incremented in jacobianSetup(), which invalidates all the cached Jacobians
+  unsigned int _jacobian_evaluation;
 };
 
 #endif // BOUNDARYFLUXBASE_H
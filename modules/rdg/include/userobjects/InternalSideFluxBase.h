@@ -28,6 +28,12 @@ InputParameters validParams<InternalSideFluxBase>();
  *
  *   2. Derived classes need to provide computing of the fluxes and their jacobians,
  *      i.e., they need to implement `calcFlux` and `calcJacobian`.
+ *
+ *   3. The cache holds a slot for each side of the local elements. A side is only
+ *      visited by the thread that owns its element, so the slots are read and written
+ *      without locking. A flux is valid for the residual evaluation that filled it, and
+ *      the Jacobians are valid until the next jacobianSetup(), so this object has to be
+ *      executed on 'nonlinear'.
  */
 class InternalSideFluxBase : public GeneralUserObject
 {
@@ -37,6 +43,9 @@ public:
   virtual void execute();
   virtual void initialize();
   virtual void finalize();
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+  virtual void jacobianSetup() override;
 
   /**
    * Get the flux vector
@@ -112,18 +121,37 @@ public:
                             DenseMatrix<Real> & jac2) const = 0;
 
 protected:
-  mutable unsigned int _cached_elem_id;
-  mutable unsigned int _cached_neig_id;
+  /// Cached flux and Jacobians of a side
+  struct SideData
+  {
+    /// residual evaluation at which the flux was computed
+    unsigned int flux_evaluation;
+    /// Jacobian evaluation at which the Jacobians were computed
+    unsigned int jacobian_evaluation;
+    /// flux vector of this side
+    std::vector<Real> flux;
+    /// Jacobian matrix contribution to the "left" cell
+    DenseMatrix<Real> jac1;
+    /// Jacobian matrix contribution to the "right" cell
+    DenseMatrix<Real> jac2;
+  };
+
+  /// Sizes the cache from the local elements of the mesh, this is called serially
+  void sizeSideData();
 
-  /// flux vector of this side
-  mutable std::vector<std::vector<Real>> _flux;
-  /// Jacobian matrix contribution to the "left" cell
-  mutable std::vector<DenseMatrix<Real>> _jac1;
-  /// Jacobian matrix contribution to the "right" cell
-  mutable std::vector<DenseMatrix<Real>> _jac2;
+  /**
+   * Get the cache slot of a side
+   * @param[in]   iside     local  index of current side
+   * @param[in]   ielem     global index of the current element
+   */
+  SideData & sideData(unsigned int iside, dof_id_type ielem) const;
 
-private:
-  static Threads::spin_mutex _mutex;
+  /// Index of the first slot of each element, indexed by the element id
+  std::vector<unsigned int> _elem_offset;
+  /// Slots for the sides of the local elements
+  mutable std::vector<SideData> _side_data;
+  /// Incremented in jacobianSetup(), which invalidates all the cached Jacobians
+  unsigned int _jacobian_evaluation;
 };
 
 #endif // INTERNALSIDEFLUXBASE_H
@@ -42,12 +42,12 @@
 
   [./internal_side_flux]
     type = AEFVUpwindInternalSideFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 
   [./free_outflow_bc]
     type = AEFVFreeOutflowBoundaryFlux
-    execute_on = 'linear'
+    execute_on = 'linear nonlinear'
   [../]
 []
 ############################################################
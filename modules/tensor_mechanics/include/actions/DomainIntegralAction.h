@@ -46,6 +46,20 @@ protected:
 
   unsigned int calcNumCrackFrontPoints();
 
+  /// Name of an integral in the 'integrals' parameter
+  std::string integralTypeName(INTEGRAL integral) const;
+
+  /// Base name of the postprocessors and vectors reporting an integral, e.g. J or II_KI
+  std::string integralBaseName(INTEGRAL integral) const;
+
+  /**
+   * Add a postprocessor for each crack front point and ring reporting the value of an integral
+   * from the vectors of the DomainIntegralVectorPostprocessor
+   */
+  void addIntegralComponentPostprocessors(const std::string & vpp_name,
+                                          const std::string & base_name,
+                                          unsigned int num_crack_front_points);
+
   std::set<INTEGRAL> _integrals;
   const std::vector<BoundaryName> & _boundary_names;
   std::vector<Point> _crack_front_points;
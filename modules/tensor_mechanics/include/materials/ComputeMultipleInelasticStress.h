@@ -76,10 +76,38 @@ protected:
    * @param model_number Use this model number
    * @param elastic_strain_increment The elastic part of _strain_increment[_qp]
    * @param combined_inelastic_strain_increment The inelastic part of _strain_increment[_qp]
+   * @param trial_stress_formed True if isQpTrialStressElastic has already placed the trial
+   * stress into _stress[_qp]
    */
   virtual void updateQpStateSingleModel(unsigned model_number,
                                         RankTwoTensor & elastic_strain_increment,
-                                        RankTwoTensor & combined_inelastic_strain_increment);
+                                        RankTwoTensor & combined_inelastic_strain_increment,
+                                        bool trial_stress_formed = false);
+
+  /**
+   * Form the trial stress (placed into _stress[_qp]) that results from applying
+   * elastic_strain_increment as an elastic strain
+   * @param elastic_strain_increment The strain increment assumed to be elastic
+   */
+  void computeQpTrialStress(const RankTwoTensor & elastic_strain_increment);
+
+  /**
+   * Form the trial stress from the entire _strain_increment[_qp] and ask the inelastic models
+   * that would be called by updateQpState or updateQpStateSingleModel whether it is elastic.
+   * @return true if all those models report that the trial stress lies in their elastic region
+   */
+  virtual bool isQpTrialStressElastic();
+
+  /**
+   * The shortcut taken instead of updateQpState and updateQpStateSingleModel when
+   * isQpTrialStressElastic returns true: the trial stress is kept, the inelastic models only
+   * propagate their stateful properties, and the tangent operator is the elasticity tensor
+   * @param elastic_strain_increment The elastic part of _strain_increment[_qp], which is all of it
+   * @param combined_inelastic_strain_increment The inelastic part of _strain_increment[_qp],
+   * which is zero
+   */
+  virtual void updateQpStateElastic(RankTwoTensor & elastic_strain_increment,
+                                    RankTwoTensor & combined_inelastic_strain_increment);
 
   /**
    * Using _elasticity_tensor[_qp] and the consistent tangent operators,
@@ -147,6 +175,17 @@ protected:
 
   MaterialProperty<Real> & _matl_timestep_limit;
 
+  /// One if the inelastic models were evaluated at the qp, zero if the elastic shortcut was taken.
+  /// The average over the mesh is the fraction of qps at which the return mapping is active.
+  MaterialProperty<Real> & _inelastic_active;
+
+  /// Whether isQpTrialStressElastic may be used when each model is called on its own.
+  /// False for models that do not check the trial stress and if an initial stress is provided.
+  std::vector<bool> _model_checks_elastic;
+
+  /// Whether isQpTrialStressElastic may be used when all the models are called
+  bool _all_models_check_elastic;
+
   /**
    * The user supplied list of inelastic models to use in the simulation
    *
@@ -93,6 +93,13 @@ protected:
   DenseVector<Real> _dsliprate_dgss;
   DenseMatrix<Real> _jacob;
   DenseMatrix<Real> _dsliprate_dsliprate;
+
+  ///Derivatives of the 2nd Piola Kirchoff stress with respect to the slip rates
+  std::vector<RankTwoTensor> _dpk2dsliprate;
+
+  ///Workspaces for the factorization of the slip rate jacobian and the update in calcUpdate
+  DenseMatrix<Real> _jacob_lu;
+  DenseVector<Real> _update;
 };
 
 #endif // FINITESTRAINCPSLIPRATERES_H
@@ -161,6 +161,13 @@ protected:
    */
   virtual void solveStress();
 
+  /**
+   * This function computes the derivatives of the inverse plastic deformation gradient with
+   * respect to the slip increments, which are constant during the stress solve.
+   * It is called at the start of solveStress.
+   */
+  void computeDfpinvDslip();
+
   /**
    * This function update stress and plastic deformation gradient after solve.
    */
@@ -339,6 +346,15 @@ protected:
 
   DenseMatrix<Real> _dgss_dsliprate;
 
+  ///Derivatives of the inverse plastic deformation gradient with respect to the slip increments.
+  ///Computed by computeDfpinvDslip as they are constant during the stress solve.
+  std::vector<RankTwoTensor> _dfpinvdslip;
+
+  ///Workspaces sized once with the number of slip systems, to avoid allocating during the solve
+  std::vector<Real> _gss_prev;
+  DenseVector<Real> _hb;
+  DenseVector<Real> _mo_rot, _no_rot;
+
   bool _read_from_slip_sys_file;
 
   bool _err_tol; ///Flag to check whether convergence is achieved
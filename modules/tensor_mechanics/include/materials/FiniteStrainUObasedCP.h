@@ -102,6 +102,12 @@ protected:
    */
   virtual void solveStress();
 
+  /**
+   * computes the derivatives of the inverse plastic deformation gradient with respect to the
+   * slip increments, which do not change during the stress solve (called by solveStress).
+   */
+  void computeDfpinvDslip();
+
   /**
    * update stress and plastic deformation gradient after solve.
    */
@@ -210,6 +216,13 @@ protected:
   /// Jacobian tensor
   RankFourTensor _jac;
 
+  /// Derivatives of the inverse plastic deformation gradient with respect to the slip increments
+  /// of each slip rate user object, constant during the stress solve (see computeDfpinvDslip)
+  std::vector<std::vector<RankTwoTensor>> _dfpinvdslip;
+
+  /// Derivatives of the slip rates with respect to the resolved shear stresses
+  std::vector<std::vector<Real>> _dslipdtau;
+
   /// Maximum number of iterations for stress update
   unsigned int _maxiter;
   /// Maximum number of iterations for internal variable update
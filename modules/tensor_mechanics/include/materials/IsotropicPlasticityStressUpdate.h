@@ -32,6 +32,14 @@ class IsotropicPlasticityStressUpdate : public RadialReturnStressUpdate
 public:
   IsotropicPlasticityStressUpdate(const InputParameters & parameters);
 
+  /**
+   * The trial stress is elastic if it does not exceed the yield stress plus the old hardening,
+   * in which case the return mapping leaves it unchanged.
+   */
+  virtual bool isTrialStressElastic(const RankTwoTensor & stress_trial,
+                                    const RankFourTensor & elasticity_tensor) override;
+  virtual bool checksTrialStressElastic() override;
+
 protected:
   virtual void initQpStatefulProperties() override;
   virtual void propagateQpStatefulProperties() override;
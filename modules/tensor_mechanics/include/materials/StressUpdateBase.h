@@ -72,6 +72,25 @@ public:
                            bool compute_full_tangent_operator,
                            RankFourTensor & tangent_operator) = 0;
 
+  /**
+   * A quick check of whether the trial stress lies within the elastic region of the model.
+   * If this returns true, updateState would return the trial stress unchanged, with a zero
+   * inelastic strain increment and the elasticity tensor as the tangent operator, so the caller
+   * may skip updateState and call propagateQpStatefulProperties instead.
+   * The default is false, so that updateState is always called.
+   * @param stress_trial The trial stress that results from applying the strain increment as an
+   * elastic strain
+   * @param elasticity_tensor The elasticity tensor
+   */
+  virtual bool isTrialStressElastic(const RankTwoTensor & stress_trial,
+                                    const RankFourTensor & elasticity_tensor);
+
+  /**
+   * Does the model implement isTrialStressElastic?  If not, the caller need not form the
+   * trial stress to ask it.
+   */
+  virtual bool checksTrialStressElastic();
+
   /// Sets the value of the global variable _qp for inheriting classes
   void setQp(unsigned int qp);
 
@@ -10,6 +10,7 @@
 #include "GeneralUserObject.h"
 #include "CrackFrontPointsProvider.h"
 #include "BoundaryRestrictable.h"
+#include "MeshChangedInterface.h"
 #include <set>
 
 class CrackFrontDefinition;
@@ -29,7 +30,9 @@ void addCrackFrontDefinitionParams(InputParameters & params);
 /**
  * Works on top of NodalNormalsPreprocessor
  */
-class CrackFrontDefinition : public GeneralUserObject, public BoundaryRestrictable
+class CrackFrontDefinition : public GeneralUserObject,
+                             public BoundaryRestrictable,
+                             public MeshChangedInterface
 {
 public:
   CrackFrontDefinition(const InputParameters & parameters);
@@ -40,7 +43,16 @@ public:
   virtual void finalize();
   virtual void execute();
 
+  /**
+   * Rebuilds the crack front and the q-function rings after the mesh has changed, e.g. due to
+   * mesh adaptivity or XFEM
+   */
+  virtual void meshChanged() override;
+
   const Node * getCrackFrontNodePtr(const unsigned int node_index) const;
+  /// Like getCrackFrontNodePtr, but returns nullptr if the node is not available on this
+  /// processor, as may happen with a distributed mesh
+  const Node * queryCrackFrontNodePtr(const unsigned int node_index) const;
   const Point * getCrackFrontPoint(const unsigned int point_index) const;
   const RealVectorValue & getCrackFrontTangent(const unsigned int point_index) const;
   Real getCrackFrontForwardSegmentLength(const unsigned int point_index) const;
@@ -85,6 +97,28 @@ public:
                     const dof_id_type connected_node_id,
                     const unsigned int node_index) const;
 
+  /**
+   * The nodes in a q-function ring of a crack front node
+   * @param ring_index the ring
+   * @param node_index the crack front node index
+   */
+  const std::set<dof_id_type> & getQFunctionRingNodes(const unsigned int ring_index,
+                                                      const unsigned int node_index) const;
+
+  /**
+   * Whether the geometric q function of a crack front point and ring is zero at every point
+   * within a sphere.  This is conservative: it may return false even if q is zero everywhere
+   * in the sphere, and is used to skip elements that are far from the crack front point.
+   * @param crack_front_point_index the crack front point index
+   * @param ring_index the index of the radii of the ring
+   * @param center the center of the sphere
+   * @param radius the radius of the sphere
+   */
+  bool isDomainIntegralQFunctionZeroInSphere(unsigned int crack_front_point_index,
+                                             unsigned int ring_index,
+                                             const Point & center,
+                                             Real radius) const;
+
   Real DomainIntegralQFunction(unsigned int crack_front_point_index,
                                unsigned int ring_index,
                                const Node * const current_node) const;
@@ -124,6 +158,8 @@ protected:
   static const Real _tol;
 
   std::vector<unsigned int> _ordered_crack_front_nodes;
+  /// Coordinates of the crack front nodes, available on every processor
+  std::map<dof_id_type, Point> _crack_front_node_coords;
   CRACK_GEOM_DEFINITION _geom_definition_method;
   std::vector<Point> _crack_front_points;
   std::vector<RealVectorValue> _tangent_directions;
@@ -166,6 +202,7 @@ protected:
   const CrackFrontPointsProvider * _crack_front_points_provider;
   unsigned int _num_points_from_provider;
 
+  void setupCrackFront(std::set<dof_id_type> & nodes);
   void getCrackFrontNodes(std::set<dof_id_type> & nodes);
   void orderCrackFrontNodes(std::set<dof_id_type> & nodes);
   void orderEndNodes(std::vector<dof_id_type> & end_nodes);
@@ -174,7 +211,7 @@ protected:
                         std::set<dof_id_type> & nodes,
                         std::map<dof_id_type, std::vector<dof_id_type>> & node_to_line_elem_map,
                         std::vector<std::vector<dof_id_type>> & line_elems);
-  unsigned int maxNodeCoor(std::vector<Node *> & nodes, unsigned int dir0 = 0);
+  unsigned int maxNodeCoor(std::vector<dof_id_type> & nodes, unsigned int dir0 = 0);
   void updateCrackFrontGeometry();
   void updateDataForCrackDirection();
   RealVectorValue calculateCrackFrontDirection(const Point & crack_front_point,
@@ -191,7 +228,7 @@ protected:
   void projectToFrontAtPoint(Real & dist_to_front,
                              Real & dist_along_tangent,
                              unsigned int crack_front_point_index,
-                             const Node * const current_node) const;
+                             const Point & current_point) const;
 };
 
 #endif /* CRACKFRONTDEFINITION_H */
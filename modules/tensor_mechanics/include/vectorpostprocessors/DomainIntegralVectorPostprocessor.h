@@ -0,0 +1,132 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef DOMAININTEGRALVECTORPOSTPROCESSOR_H
+#define DOMAININTEGRALVECTORPOSTPROCESSOR_H
+
+#include "ElementVectorPostprocessor.h"
+#include "CrackFrontDefinition.h"
+
+#include <unordered_map>
+
+// Forward Declarations
+class DomainIntegralVectorPostprocessor;
+class RankTwoTensor;
+
+template <>
+InputParameters validParams<DomainIntegralVectorPostprocessor>();
+
+/**
+ * Computes the J-integral and the interaction integrals for all of the crack front points
+ * and rings of a CrackFrontDefinition in a single element loop.
+ *
+ * Only elements with a nonzero q function for some point and ring contribute, and the
+ * q functions are only evaluated for the points and rings whose integration domains reach
+ * the element (tested with a bounding sphere of the element or the ring node sets).  The
+ * quantities shared by the integrals at a quadrature point (the shape functions, the
+ * rotations to the crack front coordinates, and the auxiliary fields) are computed once
+ * and reused. A vector with one entry per crack front point is declared for each integral
+ * and ring, e.g. J_1 or II_KI_2, matching the names of the postprocessors that
+ * JIntegral and InteractionIntegral compute for a single point.
+ */
+class DomainIntegralVectorPostprocessor : public ElementVectorPostprocessor
+{
+public:
+  DomainIntegralVectorPostprocessor(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & y) override;
+  virtual void finalize() override;
+
+  static MultiMooseEnum integralTypes();
+
+protected:
+  enum class IntegralType
+  {
+    J,
+    KI,
+    KII,
+    KIII,
+    T
+  };
+
+  /**
+   * Compute the auxiliary stress and the x1-derivative of the auxiliary displacements of
+   * a K field (KI, KII, KIII) or the T-stress field at polar position (r, theta) relative
+   * to the crack front.
+   */
+  void computeAuxFields(IntegralType type,
+                        Real r,
+                        Real theta,
+                        RankTwoTensor & aux_stress,
+                        RankTwoTensor & aux_grad_disp) const;
+
+  /// Index of the sum of an integral at a crack front point and ring within _integral_values
+  unsigned int valueIndex(unsigned int integral, unsigned int ring, unsigned int point) const
+  {
+    return (integral * _rings.size() + ring) * _num_points + point;
+  }
+
+  const CrackFrontDefinition * const _crack_front_definition;
+
+  /// The integrals to compute
+  std::vector<IntegralType> _integral_types;
+
+  /// The rings of elements (or the index of the radii) defining the integration domains
+  const std::vector<unsigned int> _rings;
+
+  /// Whether the q functions are defined by topology, otherwise by geometry
+  const bool _topological_q;
+
+  const bool _convert_J_to_K;
+  const bool _has_symmetry_plane;
+  const Real _poissons_ratio;
+  const Real _youngs_modulus;
+
+  /// Whether any interaction integrals are computed
+  bool _has_interaction_integral;
+
+  /// Material properties used by the J-integral
+  const MaterialProperty<RankTwoTensor> * _Eshelby_tensor;
+  const MaterialProperty<RealVectorValue> * _J_thermal_term_vec;
+
+  /// Material properties and variables used by the interaction integrals
+  const MaterialProperty<RankTwoTensor> * _stress;
+  const MaterialProperty<RankTwoTensor> * _strain;
+  const MaterialProperty<RankTwoTensor> * _total_deigenstrain_dT;
+  std::vector<const VariableGradient *> _grad_disp;
+  const bool _has_temp;
+  const VariableGradient & _grad_temp;
+
+  /// Plane strain constants of the auxiliary fields
+  const Real _kappa;
+  const Real _shear_modulus;
+
+  /// Number of crack front points, a single point when the crack is treated as 2D
+  unsigned int _num_points;
+
+  /// Average length of the crack front segments adjacent to each point
+  std::vector<Real> _q_avg_seg;
+
+  /// The sums of the integrals for each integral, ring and crack front point
+  std::vector<Real> _integral_values;
+
+  /// The declared vectors, one per integral and ring, filled in finalize()
+  std::vector<VectorPostprocessorValue *> _vectors;
+
+  /// The q function at the nodes of the current element for each point and ring
+  std::vector<Real> _q_curr_elem;
+
+  /// Whether the q function is nonzero in the current element for each point and ring
+  std::vector<bool> _active;
+
+  /// The points and rings (as point * number of rings + ring) of each topological ring node
+  std::unordered_map<dof_id_type, std::vector<unsigned int>> _ring_node_to_q_index;
+};
+
+#endif // DOMAININTEGRALVECTORPOSTPROCESSOR_H
@@ -0,0 +1,147 @@
+#This tests that the topological q-function rings are rebuilt when the mesh
+#is refined, even though the crack front node does not change.  The mesh is
+#uniformly refined after the first step.  The second ring contains the crack
+#tip node and its neighbors, so the q-function of that ring is one at
+#(10.5, 0) in both steps, but one at (11, 0) only before the refinement.
+
+[GlobalParams]
+  order = FIRST
+  family = LAGRANGE
+  displacements = 'disp_x disp_y'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 10
+  xmax = 20
+  ymax = 10
+[]
+
+[MeshModifiers]
+  [./crack_tip]
+    type = AddExtraNodeset
+    new_boundary = crack_tip
+    coord = '10 0'
+  [../]
+[]
+
+[Functions]
+  [./rampConstant]
+    type = PiecewiseLinear
+    x = '0. 1.'
+    y = '0. 1.'
+    scale_factor = -1e2
+  [../]
+[]
+
+[DomainIntegral]
+  integrals = JIntegral
+  boundary = crack_tip
+  crack_direction_method = CrackDirectionVector
+  crack_direction_vector = '1 0 0'
+  2d = true
+  axis_2d = 2
+  q_function_type = Topology
+  ring_first = 1
+  ring_last = 2
+  output_q = true
+[]
+
+[Modules/TensorMechanics/Master]
+  [./master]
+    strain = SMALL
+    add_variables = true
+    incremental = false
+    planar_formulation = PLANE_STRAIN
+  [../]
+[]
+
+[BCs]
+  [./no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0.0
+  [../]
+
+  [./no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = right
+    value = 0.0
+  [../]
+
+  [./Pressure]
+    [./top]
+      boundary = top
+      function = rampConstant
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 207000
+    poissons_ratio = 0.3
+  [../]
+  [./elastic_stress]
+    type = ComputeLinearElasticStress
+  [../]
+  [./eshelby]
+    type = EshelbyTensor
+  [../]
+[]
+
+[Adaptivity]
+  marker = uniform
+  max_h_level = 1
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = REFINE
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./q_2_near]
+    type = PointValue
+    variable = q_2
+    point = '10.5 0 0'
+  [../]
+  [./q_2_far]
+    type = PointValue
+    variable = q_2
+    point = '11 0 0'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = 'none'
+
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-8
+
+  start_time = 0.0
+  dt = 1
+
+  end_time = 2
+  num_steps = 2
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    show = 'q_2_near q_2_far'
+    execute_on = timestep_end
+  [../]
+[]
@@ -0,0 +1,151 @@
+#This tests that the J-Integral computed by the DomainIntegral action,
+#which skips the elements outside of the integration domains, matches
+#the J-Integral computed by JIntegral postprocessors, which integrate over
+#every element.  The rings are small compared to the mesh, so most of the
+#elements lie outside of them.  Only the differences are output, and these
+#are zero.
+
+[GlobalParams]
+  order = FIRST
+  family = LAGRANGE
+  displacements = 'disp_x disp_y'
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 40
+  ny = 20
+  xmax = 20
+  ymax = 10
+[]
+
+[MeshModifiers]
+  [./crack_tip]
+    type = AddExtraNodeset
+    new_boundary = crack_tip
+    coord = '10 0'
+  [../]
+  [./ligament]
+    type = BoundingBoxNodeSet
+    new_boundary = ligament
+    bottom_left = '9.99 -0.01 0'
+    top_right = '20.01 0.01 0'
+  [../]
+[]
+
+[Functions]
+  [./rampConstant]
+    type = PiecewiseLinear
+    x = '0. 1.'
+    y = '0. 1.'
+    scale_factor = -1e2
+  [../]
+[]
+
+[DomainIntegral]
+  integrals = JIntegral
+  boundary = crack_tip
+  crack_direction_method = CrackDirectionVector
+  crack_direction_vector = '1 0 0'
+  2d = true
+  axis_2d = 2
+  radius_inner = '0.5 1.0'
+  radius_outer = '1.0 1.5'
+  output_q = false
+[]
+
+[Modules/TensorMechanics/Master]
+  [./master]
+    strain = SMALL
+    add_variables = true
+    incremental = false
+    planar_formulation = PLANE_STRAIN
+  [../]
+[]
+
+[BCs]
+  [./crack_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = ligament
+    value = 0.0
+  [../]
+
+  [./no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = right
+    value = 0.0
+  [../]
+
+  [./Pressure]
+    [./top]
+      boundary = top
+      function = rampConstant
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 207000
+    poissons_ratio = 0.3
+  [../]
+  [./elastic_stress]
+    type = ComputeLinearElasticStress
+  [../]
+  [./eshelby]
+    type = EshelbyTensor
+  [../]
+[]
+
+[Postprocessors]
+  [./J_all_elems_1]
+    type = JIntegral
+    crack_front_definition = crackFrontDefinition
+    ring_index = 1
+  [../]
+  [./J_all_elems_2]
+    type = JIntegral
+    crack_front_definition = crackFrontDefinition
+    ring_index = 2
+  [../]
+  [./J_diff_1]
+    type = DifferencePostprocessor
+    value1 = J_1
+    value2 = J_all_elems_1
+  [../]
+  [./J_diff_2]
+    type = DifferencePostprocessor
+    value1 = J_2
+    value2 = J_all_elems_2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'lu'
+
+  line_search = 'none'
+
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-8
+
+  start_time = 0.0
+  dt = 1
+
+  end_time = 1
+  num_steps = 1
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    show = 'J_diff_1 J_diff_2'
+  [../]
+[]
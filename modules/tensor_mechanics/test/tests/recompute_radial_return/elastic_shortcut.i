@@ -0,0 +1,125 @@
+# Checks that ComputeMultipleInelasticStress skips the return mapping where the trial
+# stress is elastic, and that the inelastic_active material property reports it.
+#
+# A single element with a Poisson's ratio of zero is pulled in the y direction so that
+# stress_yy = 2500 * t while the element is elastic.  The yield stress of 25 is reached
+# at t = 0.01, so inelastic_active is zero for the first three steps and one at the last
+# step.  There the effective plastic strain increment is dp = (30 - 25) / (3.75e5 + 1000),
+# the von Mises stress is returned to 25 + 1000 * dp and, since the strain is uniaxial,
+# stress_yy = 30 - 2.5e5 * dp.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+[]
+
+[GlobalParams]
+  displacements = 'disp_x disp_y disp_z'
+[]
+
+[Functions]
+  [./top_pull]
+    type = ParsedFunction
+    value = t*(0.01)
+  [../]
+[]
+
+[Modules/TensorMechanics/Master]
+  [./all]
+    strain = SMALL
+    incremental = true
+    add_variables = true
+    generate_output = 'stress_yy vonmises_stress'
+  [../]
+[]
+
+[AuxVariables]
+  [./inelastic_active]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[AuxKernels]
+  [./inelastic_active]
+    type = MaterialRealAux
+    variable = inelastic_active
+    property = inelastic_active
+  [../]
+[]
+
+[BCs]
+  [./y_pull_function]
+    type = FunctionDirichletBC
+    variable = disp_y
+    boundary = top
+    function = top_pull
+  [../]
+  [./x_sides]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left right'
+    value = 0.0
+  [../]
+  [./y_bot]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0.0
+  [../]
+  [./z_sides]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'back front'
+    value = 0.0
+  [../]
+[]
+
+[Materials]
+  [./elasticity_tensor]
+    type = ComputeIsotropicElasticityTensor
+    youngs_modulus = 2.5e5
+    poissons_ratio = 0.0
+  [../]
+  [./isotropic_plasticity]
+    type = IsotropicPlasticityStressUpdate
+    yield_stress = 25.
+    hardening_constant = 1000.0
+  [../]
+  [./radial_return_stress]
+    type = ComputeMultipleInelasticStress
+    tangent_operator = elastic
+    inelastic_models = 'isotropic_plasticity'
+  [../]
+[]
+
+[Postprocessors]
+  [./active_fraction]
+    type = ElementAverageValue
+    variable = inelastic_active
+  [../]
+  [./stress_yy]
+    type = ElementAverageValue
+    variable = stress_yy
+  [../]
+  [./vonmises_stress]
+    type = ElementAverageValue
+    variable = vonmises_stress
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'PJFNK'
+
+  nl_rel_tol = 1e-10
+  nl_abs_tol = 1e-12
+  l_tol = 1e-9
+
+  end_time = 0.012
+  dt = 0.003
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,144 @@
+import struct
+import numpy
+
+class BinaryTimeSeriesReader(object):
+    """
+    A reader for the files written by the BinaryTimeSeries output object.
+
+    The block headers are read to build an index of the file, the data is then loaded into numpy
+    arrays directly from the file contents without parsing the values. The file format is
+    documented in framework/include/outputs/BinaryTimeSeries.h.
+
+    Args:
+        filename[str]: The *.bts file to read.
+    """
+    MAGIC = b'MOOSEBTS'
+    VERSION = 1
+    SCHEMA = 0
+    DATA = 1
+    POSTPROCESSOR = 0
+    VECTOR_POSTPROCESSOR = 1
+
+    def __init__(self, filename):
+        self.filename = filename
+        self.postprocessors = dict()
+        self.vectorpostprocessors = dict()
+        self.update()
+
+    def __contains__(self, name):
+        """
+        Returns true if the postprocessor (or scalar variable) exists.
+        """
+        return name in self.postprocessors
+
+    def __getitem__(self, name):
+        """
+        Return the values of a postprocessor (or scalar variable), including 'time' and 'timestep'.
+        """
+        return self.postprocessors[name]
+
+    def times(self):
+        """
+        Returns the times at which the postprocessors were written.
+        """
+        return self.postprocessors.get('time', numpy.empty(0))
+
+    def update(self):
+        """
+        Reload the file.
+        """
+        with open(self.filename, 'rb') as fid:
+            buf = fid.read()
+
+        if buf[0:8] != self.MAGIC:
+            raise IOError("The file '{}' is not a BinaryTimeSeries file.".format(self.filename))
+
+        # The file is written in the byte order of the machine that wrote it
+        for order in ['<', '>']:
+            if struct.unpack_from(order + 'Q', buf, 8)[0] == self.VERSION:
+                break
+        else:
+            raise IOError("Unsupported BinaryTimeSeries version in '{}'.".format(self.filename))
+
+        # Views of the entire file, every value is 8-byte aligned
+        n = len(buf) // 8
+        reals = numpy.frombuffer(buf, dtype=order + 'f8', count=n)
+        ints = numpy.frombuffer(buf, dtype=order + 'i8', count=n)
+        uints = numpy.frombuffer(buf, dtype=order + 'u8', count=n)
+
+        # Walk the block headers to build the index
+        schemas = dict()    # id -> (kind, name, columns)
+        pp_blocks = []      # (columns, offset) for each postprocessor data block
+        vpp_blocks = []     # (name, columns, offset) for each VectorPostprocessor data block
+        offset = 16
+        while offset + 16 <= len(buf):
+            block_type, series, size = struct.unpack_from(order + 'IIQ', buf, offset)
+            offset += 16
+            if offset + size > len(buf):
+                break # incomplete block, the file is still being written
+
+            if block_type == self.SCHEMA:
+                kind, ncols = struct.unpack_from(order + 'II', buf, offset)
+                pos = offset + 8
+                names = []
+                for _ in range(ncols + 1):
+                    length = struct.unpack_from(order + 'I', buf, pos)[0]
+                    names.append(buf[pos + 4:pos + 4 + length].decode('utf-8'))
+                    pos += 4 + length
+                schemas[series] = (kind, names[0], names[1:])
+
+            elif block_type == self.DATA:
+                kind, name, columns = schemas[series]
+                if kind == self.POSTPROCESSOR:
+                    pp_blocks.append((columns, offset // 8))
+                else:
+                    vpp_blocks.append((name, columns, offset // 8))
+
+            offset += size
+
+        self.postprocessors = self._readPostprocessors(pp_blocks, reals, ints)
+        self.vectorpostprocessors = self._readVectorPostprocessors(vpp_blocks, reals, ints, uints)
+
+    @staticmethod
+    def _readPostprocessors(blocks, reals, ints):
+        """
+        Gather the rows of postprocessor data into a numpy array for each column. Values of columns
+        that did not exist when a row was written are NaN.
+        """
+        data = dict()
+        if not blocks:
+            return data
+
+        index = numpy.array([b[1] for b in blocks], dtype=numpy.int64)
+        data['time'] = reals[index].copy()
+        data['timestep'] = ints[index + 1].copy()
+
+        # Rows that share the same columns are gathered together
+        groups = dict()
+        for row, (columns, _) in enumerate(blocks):
+            groups.setdefault(tuple(columns), []).append(row)
+
+        for columns, rows in groups.items():
+            rows = numpy.array(rows, dtype=numpy.int64)
+            for j, name in enumerate(columns):
+                if name not in data:
+                    data[name] = numpy.full(len(blocks), numpy.nan)
+                data[name][rows] = reals[index[rows] + 2 + j]
+        return data
+
+    @staticmethod
+    def _readVectorPostprocessors(blocks, reals, ints, uints):
+        """
+        Build a list of (time, timestep, data) for each VectorPostprocessor, where data is a dict
+        of numpy arrays (views into the file contents).
+        """
+        data = dict()
+        for name, columns, index in blocks:
+            lengths = uints[index + 2:index + 2 + len(columns)].astype(numpy.int64)
+            start = index + 2 + len(columns)
+            vectors = dict()
+            for column, length in zip(columns, lengths):
+                vectors[column] = reals[start:start + length]
+                start += length
+            data.setdefault(name, []).append((reals[index], int(ints[index + 1]), vectors))
+        return data
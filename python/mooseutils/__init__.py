@@ -14,6 +14,11 @@ try:
 except:
     pass
 
+try:
+    from BinaryTimeSeriesReader import BinaryTimeSeriesReader
+except:
+    pass
+
 try:
     from ImageDiffer import ImageDiffer
 except:
@@ -0,0 +1,90 @@
+#!/usr/bin/env python
+import os
+import struct
+import unittest
+import numpy
+import mooseutils
+
+def string(value):
+    """
+    Pack a string as its length followed by the characters.
+    """
+    return struct.pack('<I', len(value)) + value.encode('utf-8')
+
+def block(block_type, series, payload):
+    """
+    Pack a block, including the header and the padding.
+    """
+    payload += b'\0' * ((8 - len(payload) % 8) % 8)
+    return struct.pack('<IIQ', block_type, series, len(payload)) + payload
+
+def schema(series, kind, name, columns):
+    """
+    Pack a schema block.
+    """
+    payload = struct.pack('<II', kind, len(columns)) + string(name)
+    for column in columns:
+        payload += string(column)
+    return block(0, series, payload)
+
+class TestBinaryTimeSeriesReader(unittest.TestCase):
+    """
+    Test that the BinaryTimeSeriesReader loads the data written by the BinaryTimeSeries output.
+    """
+
+    def setUp(self):
+        """
+        Write a file containing two postprocessor schemas and a VectorPostprocessor.
+        """
+        self._filename = os.path.abspath('binary_time_series_reader.bts')
+        data = b'MOOSEBTS' + struct.pack('<Q', 1)
+        data += schema(0, 0, '', ['a', 'b'])
+        data += block(1, 0, struct.pack('<dqdd', 0.1, 1, 1., 2.))
+        data += schema(1, 1, 'line', ['x', 'u'])
+        data += block(1, 1, struct.pack('<dqQQddddd', 0.1, 1, 2, 3, 0., 1., 4., 5., 6.))
+        data += block(1, 0, struct.pack('<dqdd', 0.2, 2, 3., 4.))
+        data += schema(2, 0, '', ['a', 'c'])
+        data += block(1, 2, struct.pack('<dqdd', 0.3, 3, 5., 6.))
+        with open(self._filename, 'wb') as fid:
+            fid.write(data)
+
+    def tearDown(self):
+        if os.path.exists(self._filename):
+            os.remove(self._filename)
+
+    def testPostprocessors(self):
+        """
+        Test that the postprocessor columns are gathered across the blocks.
+        """
+        data = mooseutils.BinaryTimeSeriesReader(self._filename)
+        self.assertTrue('a' in data)
+        self.assertFalse('line' in data)
+        numpy.testing.assert_array_equal(data.times(), [0.1, 0.2, 0.3])
+        numpy.testing.assert_array_equal(data['timestep'], [1, 2, 3])
+        numpy.testing.assert_array_equal(data['a'], [1., 3., 5.])
+        numpy.testing.assert_array_equal(data['b'], [2., 4., numpy.nan])
+        numpy.testing.assert_array_equal(data['c'], [numpy.nan, numpy.nan, 6.])
+
+    def testVectorPostprocessors(self):
+        """
+        Test that the VectorPostprocessor vectors are loaded with their lengths.
+        """
+        data = mooseutils.BinaryTimeSeriesReader(self._filename)
+        self.assertEqual(list(data.vectorpostprocessors.keys()), ['line'])
+        time, timestep, vectors = data.vectorpostprocessors['line'][0]
+        self.assertEqual(time, 0.1)
+        self.assertEqual(timestep, 1)
+        numpy.testing.assert_array_equal(vectors['x'], [0., 1.])
+        numpy.testing.assert_array_equal(vectors['u'], [4., 5., 6.])
+
+    def testIncompleteBlock(self):
+        """
+        Test that a partially written block at the end of the file is ignored.
+        """
+        with open(self._filename, 'ab') as fid:
+            fid.write(struct.pack('<IIQ', 1, 0, 32) + struct.pack('<d', 0.4))
+        data = mooseutils.BinaryTimeSeriesReader(self._filename)
+        numpy.testing.assert_array_equal(data.times(), [0.1, 0.2, 0.3])
+
+if __name__ == '__main__':
+    unittest.main(module=__name__, verbosity=2)
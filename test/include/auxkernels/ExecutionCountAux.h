@@ -0,0 +1,39 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef EXECUTIONCOUNTAUX_H
+#define EXECUTIONCOUNTAUX_H
+
+#include "AuxKernel.h"
+
+class ExecutionCountAux;
+
+template <>
+InputParameters validParams<ExecutionCountAux>();
+
+/**
+ * Counts the evaluations at each node or element by adding one to the current value, so that the
+ * evaluations skipped because of the 'depends_on' parameter can be tested.
+ */
+class ExecutionCountAux : public AuxKernel
+{
+public:
+  ExecutionCountAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+};
+
+#endif // EXECUTIONCOUNTAUX_H
@@ -35,6 +35,10 @@ public:
 
   virtual void addPoints();
   virtual Real computeQpResidual();
+
+protected:
+  /// Whether to add the points with addPointBatch()
+  const bool _batch;
 };
 
 #endif // CACHINGPOINTSOURCE_H
@@ -0,0 +1,129 @@
+# Each ExecutionCountAux adds one to its variable whenever it is evaluated, on every time step at
+# timestep_begin and timestep_end, so the postprocessors count the evaluations that were not skipped
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./always]
+  [../]
+  [./timestep]
+  [../]
+  [./none]
+  [../]
+  [./constant]
+  [../]
+  [./coupled_constant]
+  [../]
+  [./coupled_u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./constant]
+    type = ConstantAux
+    variable = constant
+    value = 1
+    execute_on = initial
+  [../]
+  [./always]
+    type = ExecutionCountAux
+    variable = always
+    execute_on = 'timestep_begin timestep_end'
+  [../]
+  [./timestep]
+    type = ExecutionCountAux
+    variable = timestep
+    depends_on = time
+    execute_on = 'timestep_begin timestep_end'
+  [../]
+  [./none]
+    type = ExecutionCountAux
+    variable = none
+    depends_on = none
+    execute_on = 'timestep_begin timestep_end'
+  [../]
+  [./coupled_constant]
+    type = ExecutionCountAux
+    variable = coupled_constant
+    coupled = constant
+    depends_on = coupled_variables
+    execute_on = 'timestep_begin timestep_end'
+  [../]
+  [./coupled_u]
+    # u only changes during the solve, so this is skipped at timestep_begin after the first step
+    type = ExecutionCountAux
+    variable = coupled_u
+    coupled = u
+    depends_on = coupled_variables
+    execute_on = 'timestep_begin timestep_end'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./always]
+    type = NodalMaxValue
+    variable = always
+  [../]
+  [./coupled_constant]
+    type = NodalMaxValue
+    variable = coupled_constant
+  [../]
+  [./coupled_u]
+    type = NodalMaxValue
+    variable = coupled_u
+  [../]
+  [./none]
+    type = NodalMaxValue
+    variable = none
+  [../]
+  [./timestep]
+    type = NodalMaxValue
+    variable = timestep
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
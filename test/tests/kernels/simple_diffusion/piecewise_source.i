@@ -0,0 +1,61 @@
+# Diffusion with a source sampled from a finely tabulated PiecewiseLinear function of x.
+# Every quadrature point samples the table, which exercises the interval search of
+# LinearInterpolation (see speedtests).
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  [./source]
+    type = PiecewiseLinear
+    data_file = piecewise_source.csv
+    format = columns
+    axis = x
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    function = source
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = 'PJFNK'
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  exodus = true
+[]
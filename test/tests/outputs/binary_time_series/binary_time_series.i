@@ -0,0 +1,92 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./aux0]
+    order = SECOND
+    family = SCALAR
+  [../]
+[]
+
+[ICs]
+  [./aux0_IC]
+    variable = aux0
+    values = '12 13'
+    type = ScalarComponentIC
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./norm]
+    type = ElementL2Norm
+    variable = u
+  [../]
+[]
+
+[VectorPostprocessors]
+  [./line_sample]
+    type = LineValueSampler
+    variable = u
+    start_point = '0 0.5 0'
+    end_point = '1 0.5 0'
+    num_points = 11
+    sort_by = id
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 4
+  dt = 0.1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  execute_on = 'initial timestep_end'
+  [./out]
+    type = BinaryTimeSeries
+  [../]
+  # The same data in CSV files, used to check the values read back from the binary file
+  [./csv]
+    type = CSV
+    file_base = binary_time_series_csv
+  [../]
+[]
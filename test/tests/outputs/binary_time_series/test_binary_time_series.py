@@ -0,0 +1,45 @@
+#!/usr/bin/env python
+import os
+import unittest
+import numpy
+import mooseutils
+
+class TestBinaryTimeSeries(unittest.TestCase):
+    """
+    Test that the data read back from the BinaryTimeSeries output of binary_time_series.i by the
+    BinaryTimeSeriesReader matches the CSV output of the same run.
+    """
+
+    def setUp(self):
+        self._data = mooseutils.BinaryTimeSeriesReader('binary_time_series_out.bts')
+
+    def assertClose(self, actual, desired):
+        numpy.testing.assert_allclose(actual, desired, rtol=1e-12, atol=1e-12)
+
+    def testPostprocessors(self):
+        """
+        Test that the postprocessors and scalar variables match the CSV file.
+        """
+        csv = mooseutils.PostprocessorReader('binary_time_series_csv.csv')
+        self.assertTrue(csv)
+        self.assertClose(self._data.times(), csv['time'])
+        for name in ['norm', 'aux0_0', 'aux0_1']:
+            self.assertTrue(name in self._data)
+            self.assertClose(self._data[name], csv[name])
+
+    def testVectorPostprocessors(self):
+        """
+        Test that each VectorPostprocessor block matches the CSV file of its time step.
+        """
+        blocks = self._data.vectorpostprocessors['line_sample']
+        self.assertEqual(sorted(set(b[1] for b in blocks)), [0, 1, 2, 3, 4])
+        for _, timestep, vectors in blocks:
+            filename = 'binary_time_series_csv_line_sample_{:04d}.csv'.format(timestep)
+            self.assertTrue(os.path.exists(filename))
+            csv = mooseutils.MooseDataFrame(filename)
+            self.assertEqual(sorted(vectors.keys()), sorted(csv.data.keys()))
+            for name, values in vectors.items():
+                self.assertClose(values, csv[name])
+
+if __name__ == '__main__':
+    unittest.main(module=__name__, verbosity=2)
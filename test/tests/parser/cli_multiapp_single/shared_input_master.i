@@ -0,0 +1,30 @@
+# Both sub-apps read shared_input_sub.i, which is only parsed once, but each merges its own
+# command line arguments into its copy of the parsed input
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[MultiApps]
+  [./full_solve]
+    type = FullSolveMultiApp
+    execute_on = initial
+    positions = '0 0 0  2 0 0'
+    input_files = shared_input_sub.i
+  [../]
+[]
@@ -0,0 +1,47 @@
+#!/usr/bin/env python
+"""
+Writes large_input.i, an input file with many Functions and Postprocessors, which is used to
+benchmark the time spent parsing the input and extracting the object parameters.
+
+python generate_large_input.py [number of objects]
+"""
+import sys
+
+def generate(n):
+    lines = ["# Generated by generate_large_input.py, do not edit",
+             "[Mesh]",
+             "  type = GeneratedMesh",
+             "  dim = 2",
+             "  nx = 2",
+             "  ny = 2",
+             "[]",
+             "",
+             "[Problem]",
+             "  type = FEProblem",
+             "  solve = false",
+             "  kernel_coverage_check = false",
+             "[]",
+             "",
+             "[GlobalParams]",
+             "  outputs = none",
+             "[]",
+             "",
+             "[Functions]"]
+    for i in range(n):
+        lines.append("  [./f{0}] type = ParsedFunction value = 'a*x+{0}' vars = a vals = 2 [../]"
+                     .format(i))
+    lines += ["[]", "", "[Postprocessors]"]
+    for i in range(n):
+        lines.append("  [./pp{0}] type = FunctionValuePostprocessor function = f{0} "
+                     "point = '0.5 0.5 0' execute_on = initial [../]".format(i))
+    lines += ["[]",
+              "",
+              "[Executioner]",
+              "  type = Steady",
+              "[]"]
+    return '\n'.join(lines) + '\n'
+
+if __name__ == '__main__':
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 1000
+    with open('large_input.i', 'w') as fid:
+        fid.write(generate(n))
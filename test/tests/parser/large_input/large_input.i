@@ -0,0 +1,2027 @@
+# Generated by generate_large_input.py, do not edit
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+  kernel_coverage_check = false
+[]
+
+[GlobalParams]
+  outputs = none
+[]
+
+[Functions]
+  [./f0] type = ParsedFunction value = 'a*x+0' vars = a vals = 2 [../]
+  [./f1] type = ParsedFunction value = 'a*x+1' vars = a vals = 2 [../]
+  [./f2] type = ParsedFunction value = 'a*x+2' vars = a vals = 2 [../]
+  [./f3] type = ParsedFunction value = 'a*x+3' vars = a vals = 2 [../]
+  [./f4] type = ParsedFunction value = 'a*x+4' vars = a vals = 2 [../]
+  [./f5] type = ParsedFunction value = 'a*x+5' vars = a vals = 2 [../]
+  [./f6] type = ParsedFunction value = 'a*x+6' vars = a vals = 2 [../]
+  [./f7] type = ParsedFunction value = 'a*x+7' vars = a vals = 2 [../]
+  [./f8] type = ParsedFunction value = 'a*x+8' vars = a vals = 2 [../]
+  [./f9] type = ParsedFunction value = 'a*x+9' vars = a vals = 2 [../]
+  [./f10] type = ParsedFunction value = 'a*x+10' vars = a vals = 2 [../]
+  [./f11] type = ParsedFunction value = 'a*x+11' vars = a vals = 2 [../]
+  [./f12] type = ParsedFunction value = 'a*x+12' vars = a vals = 2 [../]
+  [./f13] type = ParsedFunction value = 'a*x+13' vars = a vals = 2 [../]
+  [./f14] type = ParsedFunction value = 'a*x+14' vars = a vals = 2 [../]
+  [./f15] type = ParsedFunction value = 'a*x+15' vars = a vals = 2 [../]
+  [./f16] type = ParsedFunction value = 'a*x+16' vars = a vals = 2 [../]
+  [./f17] type = ParsedFunction value = 'a*x+17' vars = a vals = 2 [../]
+  [./f18] type = ParsedFunction value = 'a*x+18' vars = a vals = 2 [../]
+  [./f19] type = ParsedFunction value = 'a*x+19' vars = a vals = 2 [../]
+  [./f20] type = ParsedFunction value = 'a*x+20' vars = a vals = 2 [../]
+  [./f21] type = ParsedFunction value = 'a*x+21' vars = a vals = 2 [../]
+  [./f22] type = ParsedFunction value = 'a*x+22' vars = a vals = 2 [../]
+  [./f23] type = ParsedFunction value = 'a*x+23' vars = a vals = 2 [../]
+  [./f24] type = ParsedFunction value = 'a*x+24' vars = a vals = 2 [../]
+  [./f25] type = ParsedFunction value = 'a*x+25' vars = a vals = 2 [../]
+  [./f26] type = ParsedFunction value = 'a*x+26' vars = a vals = 2 [../]
+  [./f27] type = ParsedFunction value = 'a*x+27' vars = a vals = 2 [../]
+  [./f28] type = ParsedFunction value = 'a*x+28' vars = a vals = 2 [../]
+  [./f29] type = ParsedFunction value = 'a*x+29' vars = a vals = 2 [../]
+  [./f30] type = ParsedFunction value = 'a*x+30' vars = a vals = 2 [../]
+  [./f31] type = ParsedFunction value = 'a*x+31' vars = a vals = 2 [../]
+  [./f32] type = ParsedFunction value = 'a*x+32' vars = a vals = 2 [../]
+  [./f33] type = ParsedFunction value = 'a*x+33' vars = a vals = 2 [../]
+  [./f34] type = ParsedFunction value = 'a*x+34' vars = a vals = 2 [../]
+  [./f35] type = ParsedFunction value = 'a*x+35' vars = a vals = 2 [../]
+  [./f36] type = ParsedFunction value = 'a*x+36' vars = a vals = 2 [../]
+  [./f37] type = ParsedFunction value = 'a*x+37' vars = a vals = 2 [../]
+  [./f38] type = ParsedFunction value = 'a*x+38' vars = a vals = 2 [../]
+  [./f39] type = ParsedFunction value = 'a*x+39' vars = a vals = 2 [../]
+  [./f40] type = ParsedFunction value = 'a*x+40' vars = a vals = 2 [../]
+  [./f41] type = ParsedFunction value = 'a*x+41' vars = a vals = 2 [../]
+  [./f42] type = ParsedFunction value = 'a*x+42' vars = a vals = 2 [../]
+  [./f43] type = ParsedFunction value = 'a*x+43' vars = a vals = 2 [../]
+  [./f44] type = ParsedFunction value = 'a*x+44' vars = a vals = 2 [../]
+  [./f45] type = ParsedFunction value = 'a*x+45' vars = a vals = 2 [../]
+  [./f46] type = ParsedFunction value = 'a*x+46' vars = a vals = 2 [../]
+  [./f47] type = ParsedFunction value = 'a*x+47' vars = a vals = 2 [../]
+  [./f48] type = ParsedFunction value = 'a*x+48' vars = a vals = 2 [../]
+  [./f49] type = ParsedFunction value = 'a*x+49' vars = a vals = 2 [../]
+  [./f50] type = ParsedFunction value = 'a*x+50' vars = a vals = 2 [../]
+  [./f51] type = ParsedFunction value = 'a*x+51' vars = a vals = 2 [../]
+  [./f52] type = ParsedFunction value = 'a*x+52' vars = a vals = 2 [../]
+  [./f53] type = ParsedFunction value = 'a*x+53' vars = a vals = 2 [../]
+  [./f54] type = ParsedFunction value = 'a*x+54' vars = a vals = 2 [../]
+  [./f55] type = ParsedFunction value = 'a*x+55' vars = a vals = 2 [../]
+  [./f56] type = ParsedFunction value = 'a*x+56' vars = a vals = 2 [../]
+  [./f57] type = ParsedFunction value = 'a*x+57' vars = a vals = 2 [../]
+  [./f58] type = ParsedFunction value = 'a*x+58' vars = a vals = 2 [../]
+  [./f59] type = ParsedFunction value = 'a*x+59' vars = a vals = 2 [../]
+  [./f60] type = ParsedFunction value = 'a*x+60' vars = a vals = 2 [../]
+  [./f61] type = ParsedFunction value = 'a*x+61' vars = a vals = 2 [../]
+  [./f62] type = ParsedFunction value = 'a*x+62' vars = a vals = 2 [../]
+  [./f63] type = ParsedFunction value = 'a*x+63' vars = a vals = 2 [../]
+  [./f64] type = ParsedFunction value = 'a*x+64' vars = a vals = 2 [../]
+  [./f65] type = ParsedFunction value = 'a*x+65' vars = a vals = 2 [../]
+  [./f66] type = ParsedFunction value = 'a*x+66' vars = a vals = 2 [../]
+  [./f67] type = ParsedFunction value = 'a*x+67' vars = a vals = 2 [../]
+  [./f68] type = ParsedFunction value = 'a*x+68' vars = a vals = 2 [../]
+  [./f69] type = ParsedFunction value = 'a*x+69' vars = a vals = 2 [../]
+  [./f70] type = ParsedFunction value = 'a*x+70' vars = a vals = 2 [../]
+  [./f71] type = ParsedFunction value = 'a*x+71' vars = a vals = 2 [../]
+  [./f72] type = ParsedFunction value = 'a*x+72' vars = a vals = 2 [../]
+  [./f73] type = ParsedFunction value = 'a*x+73' vars = a vals = 2 [../]
+  [./f74] type = ParsedFunction value = 'a*x+74' vars = a vals = 2 [../]
+  [./f75] type = ParsedFunction value = 'a*x+75' vars = a vals = 2 [../]
+  [./f76] type = ParsedFunction value = 'a*x+76' vars = a vals = 2 [../]
+  [./f77] type = ParsedFunction value = 'a*x+77' vars = a vals = 2 [../]
+  [./f78] type = ParsedFunction value = 'a*x+78' vars = a vals = 2 [../]
+  [./f79] type = ParsedFunction value = 'a*x+79' vars = a vals = 2 [../]
+  [./f80] type = ParsedFunction value = 'a*x+80' vars = a vals = 2 [../]
+  [./f81] type = ParsedFunction value = 'a*x+81' vars = a vals = 2 [../]
+  [./f82] type = ParsedFunction value = 'a*x+82' vars = a vals = 2 [../]
+  [./f83] type = ParsedFunction value = 'a*x+83' vars = a vals = 2 [../]
+  [./f84] type = ParsedFunction value = 'a*x+84' vars = a vals = 2 [../]
+  [./f85] type = ParsedFunction value = 'a*x+85' vars = a vals = 2 [../]
+  [./f86] type = ParsedFunction value = 'a*x+86' vars = a vals = 2 [../]
+  [./f87] type = ParsedFunction value = 'a*x+87' vars = a vals = 2 [../]
+  [./f88] type = ParsedFunction value = 'a*x+88' vars = a vals = 2 [../]
+  [./f89] type = ParsedFunction value = 'a*x+89' vars = a vals = 2 [../]
+  [./f90] type = ParsedFunction value = 'a*x+90' vars = a vals = 2 [../]
+  [./f91] type = ParsedFunction value = 'a*x+91' vars = a vals = 2 [../]
+  [./f92] type = ParsedFunction value = 'a*x+92' vars = a vals = 2 [../]
+  [./f93] type = ParsedFunction value = 'a*x+93' vars = a vals = 2 [../]
+  [./f94] type = ParsedFunction value = 'a*x+94' vars = a vals = 2 [../]
+  [./f95] type = ParsedFunction value = 'a*x+95' vars = a vals = 2 [../]
+  [./f96] type = ParsedFunction value = 'a*x+96' vars = a vals = 2 [../]
+  [./f97] type = ParsedFunction value = 'a*x+97' vars = a vals = 2 [../]
+  [./f98] type = ParsedFunction value = 'a*x+98' vars = a vals = 2 [../]
+  [./f99] type = ParsedFunction value = 'a*x+99' vars = a vals = 2 [../]
+  [./f100] type = ParsedFunction value = 'a*x+100' vars = a vals = 2 [../]
+  [./f101] type = ParsedFunction value = 'a*x+101' vars = a vals = 2 [../]
+  [./f102] type = ParsedFunction value = 'a*x+102' vars = a vals = 2 [../]
+  [./f103] type = ParsedFunction value = 'a*x+103' vars = a vals = 2 [../]
+  [./f104] type = ParsedFunction value = 'a*x+104' vars = a vals = 2 [../]
+  [./f105] type = ParsedFunction value = 'a*x+105' vars = a vals = 2 [../]
+  [./f106] type = ParsedFunction value = 'a*x+106' vars = a vals = 2 [../]
+  [./f107] type = ParsedFunction value = 'a*x+107' vars = a vals = 2 [../]
+  [./f108] type = ParsedFunction value = 'a*x+108' vars = a vals = 2 [../]
+  [./f109] type = ParsedFunction value = 'a*x+109' vars = a vals = 2 [../]
+  [./f110] type = ParsedFunction value = 'a*x+110' vars = a vals = 2 [../]
+  [./f111] type = ParsedFunction value = 'a*x+111' vars = a vals = 2 [../]
+  [./f112] type = ParsedFunction value = 'a*x+112' vars = a vals = 2 [../]
+  [./f113] type = ParsedFunction value = 'a*x+113' vars = a vals = 2 [../]
+  [./f114] type = ParsedFunction value = 'a*x+114' vars = a vals = 2 [../]
+  [./f115] type = ParsedFunction value = 'a*x+115' vars = a vals = 2 [../]
+  [./f116] type = ParsedFunction value = 'a*x+116' vars = a vals = 2 [../]
+  [./f117] type = ParsedFunction value = 'a*x+117' vars = a vals = 2 [../]
+  [./f118] type = ParsedFunction value = 'a*x+118' vars = a vals = 2 [../]
+  [./f119] type = ParsedFunction value = 'a*x+119' vars = a vals = 2 [../]
+  [./f120] type = ParsedFunction value = 'a*x+120' vars = a vals = 2 [../]
+  [./f121] type = ParsedFunction value = 'a*x+121' vars = a vals = 2 [../]
+  [./f122] type = ParsedFunction value = 'a*x+122' vars = a vals = 2 [../]
+  [./f123] type = ParsedFunction value = 'a*x+123' vars = a vals = 2 [../]
+  [./f124] type = ParsedFunction value = 'a*x+124' vars = a vals = 2 [../]
+  [./f125] type = ParsedFunction value = 'a*x+125' vars = a vals = 2 [../]
+  [./f126] type = ParsedFunction value = 'a*x+126' vars = a vals = 2 [../]
+  [./f127] type = ParsedFunction value = 'a*x+127' vars = a vals = 2 [../]
+  [./f128] type = ParsedFunction value = 'a*x+128' vars = a vals = 2 [../]
+  [./f129] type = ParsedFunction value = 'a*x+129' vars = a vals = 2 [../]
+  [./f130] type = ParsedFunction value = 'a*x+130' vars = a vals = 2 [../]
+  [./f131] type = ParsedFunction value = 'a*x+131' vars = a vals = 2 [../]
+  [./f132] type = ParsedFunction value = 'a*x+132' vars = a vals = 2 [../]
+  [./f133] type = ParsedFunction value = 'a*x+133' vars = a vals = 2 [../]
+  [./f134] type = ParsedFunction value = 'a*x+134' vars = a vals = 2 [../]
+  [./f135] type = ParsedFunction value = 'a*x+135' vars = a vals = 2 [../]
+  [./f136] type = ParsedFunction value = 'a*x+136' vars = a vals = 2 [../]
+  [./f137] type = ParsedFunction value = 'a*x+137' vars = a vals = 2 [../]
+  [./f138] type = ParsedFunction value = 'a*x+138' vars = a vals = 2 [../]
+  [./f139] type = ParsedFunction value = 'a*x+139' vars = a vals = 2 [../]
+  [./f140] type = ParsedFunction value = 'a*x+140' vars = a vals = 2 [../]
+  [./f141] type = ParsedFunction value = 'a*x+141' vars = a vals = 2 [../]
+  [./f142] type = ParsedFunction value = 'a*x+142' vars = a vals = 2 [../]
+  [./f143] type = ParsedFunction value = 'a*x+143' vars = a vals = 2 [../]
+  [./f144] type = ParsedFunction value = 'a*x+144' vars = a vals = 2 [../]
+  [./f145] type = ParsedFunction value = 'a*x+145' vars = a vals = 2 [../]
+  [./f146] type = ParsedFunction value = 'a*x+146' vars = a vals = 2 [../]
+  [./f147] type = ParsedFunction value = 'a*x+147' vars = a vals = 2 [../]
+  [./f148] type = ParsedFunction value = 'a*x+148' vars = a vals = 2 [../]
+  [./f149] type = ParsedFunction value = 'a*x+149' vars = a vals = 2 [../]
+  [./f150] type = ParsedFunction value = 'a*x+150' vars = a vals = 2 [../]
+  [./f151] type = ParsedFunction value = 'a*x+151' vars = a vals = 2 [../]
+  [./f152] type = ParsedFunction value = 'a*x+152' vars = a vals = 2 [../]
+  [./f153] type = ParsedFunction value = 'a*x+153' vars = a vals = 2 [../]
+  [./f154] type = ParsedFunction value = 'a*x+154' vars = a vals = 2 [../]
+  [./f155] type = ParsedFunction value = 'a*x+155' vars = a vals = 2 [../]
+  [./f156] type = ParsedFunction value = 'a*x+156' vars = a vals = 2 [../]
+  [./f157] type = ParsedFunction value = 'a*x+157' vars = a vals = 2 [../]
+  [./f158] type = ParsedFunction value = 'a*x+158' vars = a vals = 2 [../]
+  [./f159] type = ParsedFunction value = 'a*x+159' vars = a vals = 2 [../]
+  [./f160] type = ParsedFunction value = 'a*x+160' vars = a vals = 2 [../]
+  [./f161] type = ParsedFunction value = 'a*x+161' vars = a vals = 2 [../]
+  [./f162] type = ParsedFunction value = 'a*x+162' vars = a vals = 2 [../]
+  [./f163] type = ParsedFunction value = 'a*x+163' vars = a vals = 2 [../]
+  [./f164] type = ParsedFunction value = 'a*x+164' vars = a vals = 2 [../]
+  [./f165] type = ParsedFunction value = 'a*x+165' vars = a vals = 2 [../]
+  [./f166] type = ParsedFunction value = 'a*x+166' vars = a vals = 2 [../]
+  [./f167] type = ParsedFunction value = 'a*x+167' vars = a vals = 2 [../]
+  [./f168] type = ParsedFunction value = 'a*x+168' vars = a vals = 2 [../]
+  [./f169] type = ParsedFunction value = 'a*x+169' vars = a vals = 2 [../]
+  [./f170] type = ParsedFunction value = 'a*x+170' vars = a vals = 2 [../]
+  [./f171] type = ParsedFunction value = 'a*x+171' vars = a vals = 2 [../]
+  [./f172] type = ParsedFunction value = 'a*x+172' vars = a vals = 2 [../]
+  [./f173] type = ParsedFunction value = 'a*x+173' vars = a vals = 2 [../]
+  [./f174] type = ParsedFunction value = 'a*x+174' vars = a vals = 2 [../]
+  [./f175] type = ParsedFunction value = 'a*x+175' vars = a vals = 2 [../]
+  [./f176] type = ParsedFunction value = 'a*x+176' vars = a vals = 2 [../]
+  [./f177] type = ParsedFunction value = 'a*x+177' vars = a vals = 2 [../]
+  [./f178] type = ParsedFunction value = 'a*x+178' vars = a vals = 2 [../]
+  [./f179] type = ParsedFunction value = 'a*x+179' vars = a vals = 2 [../]
+  [./f180] type = ParsedFunction value = 'a*x+180' vars = a vals = 2 [../]
+  [./f181] type = ParsedFunction value = 'a*x+181' vars = a vals = 2 [../]
+  [./f182] type = ParsedFunction value = 'a*x+182' vars = a vals = 2 [../]
+  [./f183] type = ParsedFunction value = 'a*x+183' vars = a vals = 2 [../]
+  [./f184] type = ParsedFunction value = 'a*x+184' vars = a vals = 2 [../]
+  [./f185] type = ParsedFunction value = 'a*x+185' vars = a vals = 2 [../]
+  [./f186] type = ParsedFunction value = 'a*x+186' vars = a vals = 2 [../]
+  [./f187] type = ParsedFunction value = 'a*x+187' vars = a vals = 2 [../]
+  [./f188] type = ParsedFunction value = 'a*x+188' vars = a vals = 2 [../]
+  [./f189] type = ParsedFunction value = 'a*x+189' vars = a vals = 2 [../]
+  [./f190] type = ParsedFunction value = 'a*x+190' vars = a vals = 2 [../]
+  [./f191] type = ParsedFunction value = 'a*x+191' vars = a vals = 2 [../]
+  [./f192] type = ParsedFunction value = 'a*x+192' vars = a vals = 2 [../]
+  [./f193] type = ParsedFunction value = 'a*x+193' vars = a vals = 2 [../]
+  [./f194] type = ParsedFunction value = 'a*x+194' vars = a vals = 2 [../]
+  [./f195] type = ParsedFunction value = 'a*x+195' vars = a vals = 2 [../]
+  [./f196] type = ParsedFunction value = 'a*x+196' vars = a vals = 2 [../]
+  [./f197] type = ParsedFunction value = 'a*x+197' vars = a vals = 2 [../]
+  [./f198] type = ParsedFunction value = 'a*x+198' vars = a vals = 2 [../]
+  [./f199] type = ParsedFunction value = 'a*x+199' vars = a vals = 2 [../]
+  [./f200] type = ParsedFunction value = 'a*x+200' vars = a vals = 2 [../]
+  [./f201] type = ParsedFunction value = 'a*x+201' vars = a vals = 2 [../]
+  [./f202] type = ParsedFunction value = 'a*x+202' vars = a vals = 2 [../]
+  [./f203] type = ParsedFunction value = 'a*x+203' vars = a vals = 2 [../]
+  [./f204] type = ParsedFunction value = 'a*x+204' vars = a vals = 2 [../]
+  [./f205] type = ParsedFunction value = 'a*x+205' vars = a vals = 2 [../]
+  [./f206] type = ParsedFunction value = 'a*x+206' vars = a vals = 2 [../]
+  [./f207] type = ParsedFunction value = 'a*x+207' vars = a vals = 2 [../]
+  [./f208] type = ParsedFunction value = 'a*x+208' vars = a vals = 2 [../]
+  [./f209] type = ParsedFunction value = 'a*x+209' vars = a vals = 2 [../]
+  [./f210] type = ParsedFunction value = 'a*x+210' vars = a vals = 2 [../]
+  [./f211] type = ParsedFunction value = 'a*x+211' vars = a vals = 2 [../]
+  [./f212] type = ParsedFunction value = 'a*x+212' vars = a vals = 2 [../]
+  [./f213] type = ParsedFunction value = 'a*x+213' vars = a vals = 2 [../]
+  [./f214] type = ParsedFunction value = 'a*x+214' vars = a vals = 2 [../]
+  [./f215] type = ParsedFunction value = 'a*x+215' vars = a vals = 2 [../]
+  [./f216] type = ParsedFunction value = 'a*x+216' vars = a vals = 2 [../]
+  [./f217] type = ParsedFunction value = 'a*x+217' vars = a vals = 2 [../]
+  [./f218] type = ParsedFunction value = 'a*x+218' vars = a vals = 2 [../]
+  [./f219] type = ParsedFunction value = 'a*x+219' vars = a vals = 2 [../]
+  [./f220] type = ParsedFunction value = 'a*x+220' vars = a vals = 2 [../]
+  [./f221] type = ParsedFunction value = 'a*x+221' vars = a vals = 2 [../]
+  [./f222] type = ParsedFunction value = 'a*x+222' vars = a vals = 2 [../]
+  [./f223] type = ParsedFunction value = 'a*x+223' vars = a vals = 2 [../]
+  [./f224] type = ParsedFunction value = 'a*x+224' vars = a vals = 2 [../]
+  [./f225] type = ParsedFunction value = 'a*x+225' vars = a vals = 2 [../]
+  [./f226] type = ParsedFunction value = 'a*x+226' vars = a vals = 2 [../]
+  [./f227] type = ParsedFunction value = 'a*x+227' vars = a vals = 2 [../]
+  [./f228] type = ParsedFunction value = 'a*x+228' vars = a vals = 2 [../]
+  [./f229] type = ParsedFunction value = 'a*x+229' vars = a vals = 2 [../]
+  [./f230] type = ParsedFunction value = 'a*x+230' vars = a vals = 2 [../]
+  [./f231] type = ParsedFunction value = 'a*x+231' vars = a vals = 2 [../]
+  [./f232] type = ParsedFunction value = 'a*x+232' vars = a vals = 2 [../]
+  [./f233] type = ParsedFunction value = 'a*x+233' vars = a vals = 2 [../]
+  [./f234] type = ParsedFunction value = 'a*x+234' vars = a vals = 2 [../]
+  [./f235] type = ParsedFunction value = 'a*x+235' vars = a vals = 2 [../]
+  [./f236] type = ParsedFunction value = 'a*x+236' vars = a vals = 2 [../]
+  [./f237] type = ParsedFunction value = 'a*x+237' vars = a vals = 2 [../]
+  [./f238] type = ParsedFunction value = 'a*x+238' vars = a vals = 2 [../]
+  [./f239] type = ParsedFunction value = 'a*x+239' vars = a vals = 2 [../]
+  [./f240] type = ParsedFunction value = 'a*x+240' vars = a vals = 2 [../]
+  [./f241] type = ParsedFunction value = 'a*x+241' vars = a vals = 2 [../]
+  [./f242] type = ParsedFunction value = 'a*x+242' vars = a vals = 2 [../]
+  [./f243] type = ParsedFunction value = 'a*x+243' vars = a vals = 2 [../]
+  [./f244] type = ParsedFunction value = 'a*x+244' vars = a vals = 2 [../]
+  [./f245] type = ParsedFunction value = 'a*x+245' vars = a vals = 2 [../]
+  [./f246] type = ParsedFunction value = 'a*x+246' vars = a vals = 2 [../]
+  [./f247] type = ParsedFunction value = 'a*x+247' vars = a vals = 2 [../]
+  [./f248] type = ParsedFunction value = 'a*x+248' vars = a vals = 2 [../]
+  [./f249] type = ParsedFunction value = 'a*x+249' vars = a vals = 2 [../]
+  [./f250] type = ParsedFunction value = 'a*x+250' vars = a vals = 2 [../]
+  [./f251] type = ParsedFunction value = 'a*x+251' vars = a vals = 2 [../]
+  [./f252] type = ParsedFunction value = 'a*x+252' vars = a vals = 2 [../]
+  [./f253] type = ParsedFunction value = 'a*x+253' vars = a vals = 2 [../]
+  [./f254] type = ParsedFunction value = 'a*x+254' vars = a vals = 2 [../]
+  [./f255] type = ParsedFunction value = 'a*x+255' vars = a vals = 2 [../]
+  [./f256] type = ParsedFunction value = 'a*x+256' vars = a vals = 2 [../]
+  [./f257] type = ParsedFunction value = 'a*x+257' vars = a vals = 2 [../]
+  [./f258] type = ParsedFunction value = 'a*x+258' vars = a vals = 2 [../]
+  [./f259] type = ParsedFunction value = 'a*x+259' vars = a vals = 2 [../]
+  [./f260] type = ParsedFunction value = 'a*x+260' vars = a vals = 2 [../]
+  [./f261] type = ParsedFunction value = 'a*x+261' vars = a vals = 2 [../]
+  [./f262] type = ParsedFunction value = 'a*x+262' vars = a vals = 2 [../]
+  [./f263] type = ParsedFunction value = 'a*x+263' vars = a vals = 2 [../]
+  [./f264] type = ParsedFunction value = 'a*x+264' vars = a vals = 2 [../]
+  [./f265] type = ParsedFunction value = 'a*x+265' vars = a vals = 2 [../]
+  [./f266] type = ParsedFunction value = 'a*x+266' vars = a vals = 2 [../]
+  [./f267] type = ParsedFunction value = 'a*x+267' vars = a vals = 2 [../]
+  [./f268] type = ParsedFunction value = 'a*x+268' vars = a vals = 2 [../]
+  [./f269] type = ParsedFunction value = 'a*x+269' vars = a vals = 2 [../]
+  [./f270] type = ParsedFunction value = 'a*x+270' vars = a vals = 2 [../]
+  [./f271] type = ParsedFunction value = 'a*x+271' vars = a vals = 2 [../]
+  [./f272] type = ParsedFunction value = 'a*x+272' vars = a vals = 2 [../]
+  [./f273] type = ParsedFunction value = 'a*x+273' vars = a vals = 2 [../]
+  [./f274] type = ParsedFunction value = 'a*x+274' vars = a vals = 2 [../]
+  [./f275] type = ParsedFunction value = 'a*x+275' vars = a vals = 2 [../]
+  [./f276] type = ParsedFunction value = 'a*x+276' vars = a vals = 2 [../]
+  [./f277] type = ParsedFunction value = 'a*x+277' vars = a vals = 2 [../]
+  [./f278] type = ParsedFunction value = 'a*x+278' vars = a vals = 2 [../]
+  [./f279] type = ParsedFunction value = 'a*x+279' vars = a vals = 2 [../]
+  [./f280] type = ParsedFunction value = 'a*x+280' vars = a vals = 2 [../]
+  [./f281] type = ParsedFunction value = 'a*x+281' vars = a vals = 2 [../]
+  [./f282] type = ParsedFunction value = 'a*x+282' vars = a vals = 2 [../]
+  [./f283] type = ParsedFunction value = 'a*x+283' vars = a vals = 2 [../]
+  [./f284] type = ParsedFunction value = 'a*x+284' vars = a vals = 2 [../]
+  [./f285] type = ParsedFunction value = 'a*x+285' vars = a vals = 2 [../]
+  [./f286] type = ParsedFunction value = 'a*x+286' vars = a vals = 2 [../]
+  [./f287] type = ParsedFunction value = 'a*x+287' vars = a vals = 2 [../]
+  [./f288] type = ParsedFunction value = 'a*x+288' vars = a vals = 2 [../]
+  [./f289] type = ParsedFunction value = 'a*x+289' vars = a vals = 2 [../]
+  [./f290] type = ParsedFunction value = 'a*x+290' vars = a vals = 2 [../]
+  [./f291] type = ParsedFunction value = 'a*x+291' vars = a vals = 2 [../]
+  [./f292] type = ParsedFunction value = 'a*x+292' vars = a vals = 2 [../]
+  [./f293] type = ParsedFunction value = 'a*x+293' vars = a vals = 2 [../]
+  [./f294] type = ParsedFunction value = 'a*x+294' vars = a vals = 2 [../]
+  [./f295] type = ParsedFunction value = 'a*x+295' vars = a vals = 2 [../]
+  [./f296] type = ParsedFunction value = 'a*x+296' vars = a vals = 2 [../]
+  [./f297] type = ParsedFunction value = 'a*x+297' vars = a vals = 2 [../]
+  [./f298] type = ParsedFunction value = 'a*x+298' vars = a vals = 2 [../]
+  [./f299] type = ParsedFunction value = 'a*x+299' vars = a vals = 2 [../]
+  [./f300] type = ParsedFunction value = 'a*x+300' vars = a vals = 2 [../]
+  [./f301] type = ParsedFunction value = 'a*x+301' vars = a vals = 2 [../]
+  [./f302] type = ParsedFunction value = 'a*x+302' vars = a vals = 2 [../]
+  [./f303] type = ParsedFunction value = 'a*x+303' vars = a vals = 2 [../]
+  [./f304] type = ParsedFunction value = 'a*x+304' vars = a vals = 2 [../]
+  [./f305] type = ParsedFunction value = 'a*x+305' vars = a vals = 2 [../]
+  [./f306] type = ParsedFunction value = 'a*x+306' vars = a vals = 2 [../]
+  [./f307] type = ParsedFunction value = 'a*x+307' vars = a vals = 2 [../]
+  [./f308] type = ParsedFunction value = 'a*x+308' vars = a vals = 2 [../]
+  [./f309] type = ParsedFunction value = 'a*x+309' vars = a vals = 2 [../]
+  [./f310] type = ParsedFunction value = 'a*x+310' vars = a vals = 2 [../]
+  [./f311] type = ParsedFunction value = 'a*x+311' vars = a vals = 2 [../]
+  [./f312] type = ParsedFunction value = 'a*x+312' vars = a vals = 2 [../]
+  [./f313] type = ParsedFunction value = 'a*x+313' vars = a vals = 2 [../]
+  [./f314] type = ParsedFunction value = 'a*x+314' vars = a vals = 2 [../]
+  [./f315] type = ParsedFunction value = 'a*x+315' vars = a vals = 2 [../]
+  [./f316] type = ParsedFunction value = 'a*x+316' vars = a vals = 2 [../]
+  [./f317] type = ParsedFunction value = 'a*x+317' vars = a vals = 2 [../]
+  [./f318] type = ParsedFunction value = 'a*x+318' vars = a vals = 2 [../]
+  [./f319] type = ParsedFunction value = 'a*x+319' vars = a vals = 2 [../]
+  [./f320] type = ParsedFunction value = 'a*x+320' vars = a vals = 2 [../]
+  [./f321] type = ParsedFunction value = 'a*x+321' vars = a vals = 2 [../]
+  [./f322] type = ParsedFunction value = 'a*x+322' vars = a vals = 2 [../]
+  [./f323] type = ParsedFunction value = 'a*x+323' vars = a vals = 2 [../]
+  [./f324] type = ParsedFunction value = 'a*x+324' vars = a vals = 2 [../]
+  [./f325] type = ParsedFunction value = 'a*x+325' vars = a vals = 2 [../]
+  [./f326] type = ParsedFunction value = 'a*x+326' vars = a vals = 2 [../]
+  [./f327] type = ParsedFunction value = 'a*x+327' vars = a vals = 2 [../]
+  [./f328] type = ParsedFunction value = 'a*x+328' vars = a vals = 2 [../]
+  [./f329] type = ParsedFunction value = 'a*x+329' vars = a vals = 2 [../]
+  [./f330] type = ParsedFunction value = 'a*x+330' vars = a vals = 2 [../]
+  [./f331] type = ParsedFunction value = 'a*x+331' vars = a vals = 2 [../]
+  [./f332] type = ParsedFunction value = 'a*x+332' vars = a vals = 2 [../]
+  [./f333] type = ParsedFunction value = 'a*x+333' vars = a vals = 2 [../]
+  [./f334] type = ParsedFunction value = 'a*x+334' vars = a vals = 2 [../]
+  [./f335] type = ParsedFunction value = 'a*x+335' vars = a vals = 2 [../]
+  [./f336] type = ParsedFunction value = 'a*x+336' vars = a vals = 2 [../]
+  [./f337] type = ParsedFunction value = 'a*x+337' vars = a vals = 2 [../]
+  [./f338] type = ParsedFunction value = 'a*x+338' vars = a vals = 2 [../]
+  [./f339] type = ParsedFunction value = 'a*x+339' vars = a vals = 2 [../]
+  [./f340] type = ParsedFunction value = 'a*x+340' vars = a vals = 2 [../]
+  [./f341] type = ParsedFunction value = 'a*x+341' vars = a vals = 2 [../]
+  [./f342] type = ParsedFunction value = 'a*x+342' vars = a vals = 2 [../]
+  [./f343] type = ParsedFunction value = 'a*x+343' vars = a vals = 2 [../]
+  [./f344] type = ParsedFunction value = 'a*x+344' vars = a vals = 2 [../]
+  [./f345] type = ParsedFunction value = 'a*x+345' vars = a vals = 2 [../]
+  [./f346] type = ParsedFunction value = 'a*x+346' vars = a vals = 2 [../]
+  [./f347] type = ParsedFunction value = 'a*x+347' vars = a vals = 2 [../]
+  [./f348] type = ParsedFunction value = 'a*x+348' vars = a vals = 2 [../]
+  [./f349] type = ParsedFunction value = 'a*x+349' vars = a vals = 2 [../]
+  [./f350] type = ParsedFunction value = 'a*x+350' vars = a vals = 2 [../]
+  [./f351] type = ParsedFunction value = 'a*x+351' vars = a vals = 2 [../]
+  [./f352] type = ParsedFunction value = 'a*x+352' vars = a vals = 2 [../]
+  [./f353] type = ParsedFunction value = 'a*x+353' vars = a vals = 2 [../]
+  [./f354] type = ParsedFunction value = 'a*x+354' vars = a vals = 2 [../]
+  [./f355] type = ParsedFunction value = 'a*x+355' vars = a vals = 2 [../]
+  [./f356] type = ParsedFunction value = 'a*x+356' vars = a vals = 2 [../]
+  [./f357] type = ParsedFunction value = 'a*x+357' vars = a vals = 2 [../]
+  [./f358] type = ParsedFunction value = 'a*x+358' vars = a vals = 2 [../]
+  [./f359] type = ParsedFunction value = 'a*x+359' vars = a vals = 2 [../]
+  [./f360] type = ParsedFunction value = 'a*x+360' vars = a vals = 2 [../]
+  [./f361] type = ParsedFunction value = 'a*x+361' vars = a vals = 2 [../]
+  [./f362] type = ParsedFunction value = 'a*x+362' vars = a vals = 2 [../]
+  [./f363] type = ParsedFunction value = 'a*x+363' vars = a vals = 2 [../]
+  [./f364] type = ParsedFunction value = 'a*x+364' vars = a vals = 2 [../]
+  [./f365] type = ParsedFunction value = 'a*x+365' vars = a vals = 2 [../]
+  [./f366] type = ParsedFunction value = 'a*x+366' vars = a vals = 2 [../]
+  [./f367] type = ParsedFunction value = 'a*x+367' vars = a vals = 2 [../]
+  [./f368] type = ParsedFunction value = 'a*x+368' vars = a vals = 2 [../]
+  [./f369] type = ParsedFunction value = 'a*x+369' vars = a vals = 2 [../]
+  [./f370] type = ParsedFunction value = 'a*x+370' vars = a vals = 2 [../]
+  [./f371] type = ParsedFunction value = 'a*x+371' vars = a vals = 2 [../]
+  [./f372] type = ParsedFunction value = 'a*x+372' vars = a vals = 2 [../]
+  [./f373] type = ParsedFunction value = 'a*x+373' vars = a vals = 2 [../]
+  [./f374] type = ParsedFunction value = 'a*x+374' vars = a vals = 2 [../]
+  [./f375] type = ParsedFunction value = 'a*x+375' vars = a vals = 2 [../]
+  [./f376] type = ParsedFunction value = 'a*x+376' vars = a vals = 2 [../]
+  [./f377] type = ParsedFunction value = 'a*x+377' vars = a vals = 2 [../]
+  [./f378] type = ParsedFunction value = 'a*x+378' vars = a vals = 2 [../]
+  [./f379] type = ParsedFunction value = 'a*x+379' vars = a vals = 2 [../]
+  [./f380] type = ParsedFunction value = 'a*x+380' vars = a vals = 2 [../]
+  [./f381] type = ParsedFunction value = 'a*x+381' vars = a vals = 2 [../]
+  [./f382] type = ParsedFunction value = 'a*x+382' vars = a vals = 2 [../]
+  [./f383] type = ParsedFunction value = 'a*x+383' vars = a vals = 2 [../]
+  [./f384] type = ParsedFunction value = 'a*x+384' vars = a vals = 2 [../]
+  [./f385] type = ParsedFunction value = 'a*x+385' vars = a vals = 2 [../]
+  [./f386] type = ParsedFunction value = 'a*x+386' vars = a vals = 2 [../]
+  [./f387] type = ParsedFunction value = 'a*x+387' vars = a vals = 2 [../]
+  [./f388] type = ParsedFunction value = 'a*x+388' vars = a vals = 2 [../]
+  [./f389] type = ParsedFunction value = 'a*x+389' vars = a vals = 2 [../]
+  [./f390] type = ParsedFunction value = 'a*x+390' vars = a vals = 2 [../]
+  [./f391] type = ParsedFunction value = 'a*x+391' vars = a vals = 2 [../]
+  [./f392] type = ParsedFunction value = 'a*x+392' vars = a vals = 2 [../]
+  [./f393] type = ParsedFunction value = 'a*x+393' vars = a vals = 2 [../]
+  [./f394] type = ParsedFunction value = 'a*x+394' vars = a vals = 2 [../]
+  [./f395] type = ParsedFunction value = 'a*x+395' vars = a vals = 2 [../]
+  [./f396] type = ParsedFunction value = 'a*x+396' vars = a vals = 2 [../]
+  [./f397] type = ParsedFunction value = 'a*x+397' vars = a vals = 2 [../]
+  [./f398] type = ParsedFunction value = 'a*x+398' vars = a vals = 2 [../]
+  [./f399] type = ParsedFunction value = 'a*x+399' vars = a vals = 2 [../]
+  [./f400] type = ParsedFunction value = 'a*x+400' vars = a vals = 2 [../]
+  [./f401] type = ParsedFunction value = 'a*x+401' vars = a vals = 2 [../]
+  [./f402] type = ParsedFunction value = 'a*x+402' vars = a vals = 2 [../]
+  [./f403] type = ParsedFunction value = 'a*x+403' vars = a vals = 2 [../]
+  [./f404] type = ParsedFunction value = 'a*x+404' vars = a vals = 2 [../]
+  [./f405] type = ParsedFunction value = 'a*x+405' vars = a vals = 2 [../]
+  [./f406] type = ParsedFunction value = 'a*x+406' vars = a vals = 2 [../]
+  [./f407] type = ParsedFunction value = 'a*x+407' vars = a vals = 2 [../]
+  [./f408] type = ParsedFunction value = 'a*x+408' vars = a vals = 2 [../]
+  [./f409] type = ParsedFunction value = 'a*x+409' vars = a vals = 2 [../]
+  [./f410] type = ParsedFunction value = 'a*x+410' vars = a vals = 2 [../]
+  [./f411] type = ParsedFunction value = 'a*x+411' vars = a vals = 2 [../]
+  [./f412] type = ParsedFunction value = 'a*x+412' vars = a vals = 2 [../]
+  [./f413] type = ParsedFunction value = 'a*x+413' vars = a vals = 2 [../]
+  [./f414] type = ParsedFunction value = 'a*x+414' vars = a vals = 2 [../]
+  [./f415] type = ParsedFunction value = 'a*x+415' vars = a vals = 2 [../]
+  [./f416] type = ParsedFunction value = 'a*x+416' vars = a vals = 2 [../]
+  [./f417] type = ParsedFunction value = 'a*x+417' vars = a vals = 2 [../]
+  [./f418] type = ParsedFunction value = 'a*x+418' vars = a vals = 2 [../]
+  [./f419] type = ParsedFunction value = 'a*x+419' vars = a vals = 2 [../]
+  [./f420] type = ParsedFunction value = 'a*x+420' vars = a vals = 2 [../]
+  [./f421] type = ParsedFunction value = 'a*x+421' vars = a vals = 2 [../]
+  [./f422] type = ParsedFunction value = 'a*x+422' vars = a vals = 2 [../]
+  [./f423] type = ParsedFunction value = 'a*x+423' vars = a vals = 2 [../]
+  [./f424] type = ParsedFunction value = 'a*x+424' vars = a vals = 2 [../]
+  [./f425] type = ParsedFunction value = 'a*x+425' vars = a vals = 2 [../]
+  [./f426] type = ParsedFunction value = 'a*x+426' vars = a vals = 2 [../]
+  [./f427] type = ParsedFunction value = 'a*x+427' vars = a vals = 2 [../]
+  [./f428] type = ParsedFunction value = 'a*x+428' vars = a vals = 2 [../]
+  [./f429] type = ParsedFunction value = 'a*x+429' vars = a vals = 2 [../]
+  [./f430] type = ParsedFunction value = 'a*x+430' vars = a vals = 2 [../]
+  [./f431] type = ParsedFunction value = 'a*x+431' vars = a vals = 2 [../]
+  [./f432] type = ParsedFunction value = 'a*x+432' vars = a vals = 2 [../]
+  [./f433] type = ParsedFunction value = 'a*x+433' vars = a vals = 2 [../]
+  [./f434] type = ParsedFunction value = 'a*x+434' vars = a vals = 2 [../]
+  [./f435] type = ParsedFunction value = 'a*x+435' vars = a vals = 2 [../]
+  [./f436] type = ParsedFunction value = 'a*x+436' vars = a vals = 2 [../]
+  [./f437] type = ParsedFunction value = 'a*x+437' vars = a vals = 2 [../]
+  [./f438] type = ParsedFunction value = 'a*x+438' vars = a vals = 2 [../]
+  [./f439] type = ParsedFunction value = 'a*x+439' vars = a vals = 2 [../]
+  [./f440] type = ParsedFunction value = 'a*x+440' vars = a vals = 2 [../]
+  [./f441] type = ParsedFunction value = 'a*x+441' vars = a vals = 2 [../]
+  [./f442] type = ParsedFunction value = 'a*x+442' vars = a vals = 2 [../]
+  [./f443] type = ParsedFunction value = 'a*x+443' vars = a vals = 2 [../]
+  [./f444] type = ParsedFunction value = 'a*x+444' vars = a vals = 2 [../]
+  [./f445] type = ParsedFunction value = 'a*x+445' vars = a vals = 2 [../]
+  [./f446] type = ParsedFunction value = 'a*x+446' vars = a vals = 2 [../]
+  [./f447] type = ParsedFunction value = 'a*x+447' vars = a vals = 2 [../]
+  [./f448] type = ParsedFunction value = 'a*x+448' vars = a vals = 2 [../]
+  [./f449] type = ParsedFunction value = 'a*x+449' vars = a vals = 2 [../]
+  [./f450] type = ParsedFunction value = 'a*x+450' vars = a vals = 2 [../]
+  [./f451] type = ParsedFunction value = 'a*x+451' vars = a vals = 2 [../]
+  [./f452] type = ParsedFunction value = 'a*x+452' vars = a vals = 2 [../]
+  [./f453] type = ParsedFunction value = 'a*x+453' vars = a vals = 2 [../]
+  [./f454] type = ParsedFunction value = 'a*x+454' vars = a vals = 2 [../]
+  [./f455] type = ParsedFunction value = 'a*x+455' vars = a vals = 2 [../]
+  [./f456] type = ParsedFunction value = 'a*x+456' vars = a vals = 2 [../]
+  [./f457] type = ParsedFunction value = 'a*x+457' vars = a vals = 2 [../]
+  [./f458] type = ParsedFunction value = 'a*x+458' vars = a vals = 2 [../]
+  [./f459] type = ParsedFunction value = 'a*x+459' vars = a vals = 2 [../]
+  [./f460] type = ParsedFunction value = 'a*x+460' vars = a vals = 2 [../]
+  [./f461] type = ParsedFunction value = 'a*x+461' vars = a vals = 2 [../]
+  [./f462] type = ParsedFunction value = 'a*x+462' vars = a vals = 2 [../]
+  [./f463] type = ParsedFunction value = 'a*x+463' vars = a vals = 2 [../]
+  [./f464] type = ParsedFunction value = 'a*x+464' vars = a vals = 2 [../]
+  [./f465] type = ParsedFunction value = 'a*x+465' vars = a vals = 2 [../]
+  [./f466] type = ParsedFunction value = 'a*x+466' vars = a vals = 2 [../]
+  [./f467] type = ParsedFunction value = 'a*x+467' vars = a vals = 2 [../]
+  [./f468] type = ParsedFunction value = 'a*x+468' vars = a vals = 2 [../]
+  [./f469] type = ParsedFunction value = 'a*x+469' vars = a vals = 2 [../]
+  [./f470] type = ParsedFunction value = 'a*x+470' vars = a vals = 2 [../]
+  [./f471] type = ParsedFunction value = 'a*x+471' vars = a vals = 2 [../]
+  [./f472] type = ParsedFunction value = 'a*x+472' vars = a vals = 2 [../]
+  [./f473] type = ParsedFunction value = 'a*x+473' vars = a vals = 2 [../]
+  [./f474] type = ParsedFunction value = 'a*x+474' vars = a vals = 2 [../]
+  [./f475] type = ParsedFunction value = 'a*x+475' vars = a vals = 2 [../]
+  [./f476] type = ParsedFunction value = 'a*x+476' vars = a vals = 2 [../]
+  [./f477] type = ParsedFunction value = 'a*x+477' vars = a vals = 2 [../]
+  [./f478] type = ParsedFunction value = 'a*x+478' vars = a vals = 2 [../]
+  [./f479] type = ParsedFunction value = 'a*x+479' vars = a vals = 2 [../]
+  [./f480] type = ParsedFunction value = 'a*x+480' vars = a vals = 2 [../]
+  [./f481] type = ParsedFunction value = 'a*x+481' vars = a vals = 2 [../]
+  [./f482] type = ParsedFunction value = 'a*x+482' vars = a vals = 2 [../]
+  [./f483] type = ParsedFunction value = 'a*x+483' vars = a vals = 2 [../]
+  [./f484] type = ParsedFunction value = 'a*x+484' vars = a vals = 2 [../]
+  [./f485] type = ParsedFunction value = 'a*x+485' vars = a vals = 2 [../]
+  [./f486] type = ParsedFunction value = 'a*x+486' vars = a vals = 2 [../]
+  [./f487] type = ParsedFunction value = 'a*x+487' vars = a vals = 2 [../]
+  [./f488] type = ParsedFunction value = 'a*x+488' vars = a vals = 2 [../]
+  [./f489] type = ParsedFunction value = 'a*x+489' vars = a vals = 2 [../]
+  [./f490] type = ParsedFunction value = 'a*x+490' vars = a vals = 2 [../]
+  [./f491] type = ParsedFunction value = 'a*x+491' vars = a vals = 2 [../]
+  [./f492] type = ParsedFunction value = 'a*x+492' vars = a vals = 2 [../]
+  [./f493] type = ParsedFunction value = 'a*x+493' vars = a vals = 2 [../]
+  [./f494] type = ParsedFunction value = 'a*x+494' vars = a vals = 2 [../]
+  [./f495] type = ParsedFunction value = 'a*x+495' vars = a vals = 2 [../]
+  [./f496] type = ParsedFunction value = 'a*x+496' vars = a vals = 2 [../]
+  [./f497] type = ParsedFunction value = 'a*x+497' vars = a vals = 2 [../]
+  [./f498] type = ParsedFunction value = 'a*x+498' vars = a vals = 2 [../]
+  [./f499] type = ParsedFunction value = 'a*x+499' vars = a vals = 2 [../]
+  [./f500] type = ParsedFunction value = 'a*x+500' vars = a vals = 2 [../]
+  [./f501] type = ParsedFunction value = 'a*x+501' vars = a vals = 2 [../]
+  [./f502] type = ParsedFunction value = 'a*x+502' vars = a vals = 2 [../]
+  [./f503] type = ParsedFunction value = 'a*x+503' vars = a vals = 2 [../]
+  [./f504] type = ParsedFunction value = 'a*x+504' vars = a vals = 2 [../]
+  [./f505] type = ParsedFunction value = 'a*x+505' vars = a vals = 2 [../]
+  [./f506] type = ParsedFunction value = 'a*x+506' vars = a vals = 2 [../]
+  [./f507] type = ParsedFunction value = 'a*x+507' vars = a vals = 2 [../]
+  [./f508] type = ParsedFunction value = 'a*x+508' vars = a vals = 2 [../]
+  [./f509] type = ParsedFunction value = 'a*x+509' vars = a vals = 2 [../]
+  [./f510] type = ParsedFunction value = 'a*x+510' vars = a vals = 2 [../]
+  [./f511] type = ParsedFunction value = 'a*x+511' vars = a vals = 2 [../]
+  [./f512] type = ParsedFunction value = 'a*x+512' vars = a vals = 2 [../]
+  [./f513] type = ParsedFunction value = 'a*x+513' vars = a vals = 2 [../]
+  [./f514] type = ParsedFunction value = 'a*x+514' vars = a vals = 2 [../]
+  [./f515] type = ParsedFunction value = 'a*x+515' vars = a vals = 2 [../]
+  [./f516] type = ParsedFunction value = 'a*x+516' vars = a vals = 2 [../]
+  [./f517] type = ParsedFunction value = 'a*x+517' vars = a vals = 2 [../]
+  [./f518] type = ParsedFunction value = 'a*x+518' vars = a vals = 2 [../]
+  [./f519] type = ParsedFunction value = 'a*x+519' vars = a vals = 2 [../]
+  [./f520] type = ParsedFunction value = 'a*x+520' vars = a vals = 2 [../]
+  [./f521] type = ParsedFunction value = 'a*x+521' vars = a vals = 2 [../]
+  [./f522] type = ParsedFunction value = 'a*x+522' vars = a vals = 2 [../]
+  [./f523] type = ParsedFunction value = 'a*x+523' vars = a vals = 2 [../]
+  [./f524] type = ParsedFunction value = 'a*x+524' vars = a vals = 2 [../]
+  [./f525] type = ParsedFunction value = 'a*x+525' vars = a vals = 2 [../]
+  [./f526] type = ParsedFunction value = 'a*x+526' vars = a vals = 2 [../]
+  [./f527] type = ParsedFunction value = 'a*x+527' vars = a vals = 2 [../]
+  [./f528] type = ParsedFunction value = 'a*x+528' vars = a vals = 2 [../]
+  [./f529] type = ParsedFunction value = 'a*x+529' vars = a vals = 2 [../]
+  [./f530] type = ParsedFunction value = 'a*x+530' vars = a vals = 2 [../]
+  [./f531] type = ParsedFunction value = 'a*x+531' vars = a vals = 2 [../]
+  [./f532] type = ParsedFunction value = 'a*x+532' vars = a vals = 2 [../]
+  [./f533] type = ParsedFunction value = 'a*x+533' vars = a vals = 2 [../]
+  [./f534] type = ParsedFunction value = 'a*x+534' vars = a vals = 2 [../]
+  [./f535] type = ParsedFunction value = 'a*x+535' vars = a vals = 2 [../]
+  [./f536] type = ParsedFunction value = 'a*x+536' vars = a vals = 2 [../]
+  [./f537] type = ParsedFunction value = 'a*x+537' vars = a vals = 2 [../]
+  [./f538] type = ParsedFunction value = 'a*x+538' vars = a vals = 2 [../]
+  [./f539] type = ParsedFunction value = 'a*x+539' vars = a vals = 2 [../]
+  [./f540] type = ParsedFunction value = 'a*x+540' vars = a vals = 2 [../]
+  [./f541] type = ParsedFunction value = 'a*x+541' vars = a vals = 2 [../]
+  [./f542] type = ParsedFunction value = 'a*x+542' vars = a vals = 2 [../]
+  [./f543] type = ParsedFunction value = 'a*x+543' vars = a vals = 2 [../]
+  [./f544] type = ParsedFunction value = 'a*x+544' vars = a vals = 2 [../]
+  [./f545] type = ParsedFunction value = 'a*x+545' vars = a vals = 2 [../]
+  [./f546] type = ParsedFunction value = 'a*x+546' vars = a vals = 2 [../]
+  [./f547] type = ParsedFunction value = 'a*x+547' vars = a vals = 2 [../]
+  [./f548] type = ParsedFunction value = 'a*x+548' vars = a vals = 2 [../]
+  [./f549] type = ParsedFunction value = 'a*x+549' vars = a vals = 2 [../]
+  [./f550] type = ParsedFunction value = 'a*x+550' vars = a vals = 2 [../]
+  [./f551] type = ParsedFunction value = 'a*x+551' vars = a vals = 2 [../]
+  [./f552] type = ParsedFunction value = 'a*x+552' vars = a vals = 2 [../]
+  [./f553] type = ParsedFunction value = 'a*x+553' vars = a vals = 2 [../]
+  [./f554] type = ParsedFunction value = 'a*x+554' vars = a vals = 2 [../]
+  [./f555] type = ParsedFunction value = 'a*x+555' vars = a vals = 2 [../]
+  [./f556] type = ParsedFunction value = 'a*x+556' vars = a vals = 2 [../]
+  [./f557] type = ParsedFunction value = 'a*x+557' vars = a vals = 2 [../]
+  [./f558] type = ParsedFunction value = 'a*x+558' vars = a vals = 2 [../]
+  [./f559] type = ParsedFunction value = 'a*x+559' vars = a vals = 2 [../]
+  [./f560] type = ParsedFunction value = 'a*x+560' vars = a vals = 2 [../]
+  [./f561] type = ParsedFunction value = 'a*x+561' vars = a vals = 2 [../]
+  [./f562] type = ParsedFunction value = 'a*x+562' vars = a vals = 2 [../]
+  [./f563] type = ParsedFunction value = 'a*x+563' vars = a vals = 2 [../]
+  [./f564] type = ParsedFunction value = 'a*x+564' vars = a vals = 2 [../]
+  [./f565] type = ParsedFunction value = 'a*x+565' vars = a vals = 2 [../]
+  [./f566] type = ParsedFunction value = 'a*x+566' vars = a vals = 2 [../]
+  [./f567] type = ParsedFunction value = 'a*x+567' vars = a vals = 2 [../]
+  [./f568] type = ParsedFunction value = 'a*x+568' vars = a vals = 2 [../]
+  [./f569] type = ParsedFunction value = 'a*x+569' vars = a vals = 2 [../]
+  [./f570] type = ParsedFunction value = 'a*x+570' vars = a vals = 2 [../]
+  [./f571] type = ParsedFunction value = 'a*x+571' vars = a vals = 2 [../]
+  [./f572] type = ParsedFunction value = 'a*x+572' vars = a vals = 2 [../]
+  [./f573] type = ParsedFunction value = 'a*x+573' vars = a vals = 2 [../]
+  [./f574] type = ParsedFunction value = 'a*x+574' vars = a vals = 2 [../]
+  [./f575] type = ParsedFunction value = 'a*x+575' vars = a vals = 2 [../]
+  [./f576] type = ParsedFunction value = 'a*x+576' vars = a vals = 2 [../]
+  [./f577] type = ParsedFunction value = 'a*x+577' vars = a vals = 2 [../]
+  [./f578] type = ParsedFunction value = 'a*x+578' vars = a vals = 2 [../]
+  [./f579] type = ParsedFunction value = 'a*x+579' vars = a vals = 2 [../]
+  [./f580] type = ParsedFunction value = 'a*x+580' vars = a vals = 2 [../]
+  [./f581] type = ParsedFunction value = 'a*x+581' vars = a vals = 2 [../]
+  [./f582] type = ParsedFunction value = 'a*x+582' vars = a vals = 2 [../]
+  [./f583] type = ParsedFunction value = 'a*x+583' vars = a vals = 2 [../]
+  [./f584] type = ParsedFunction value = 'a*x+584' vars = a vals = 2 [../]
+  [./f585] type = ParsedFunction value = 'a*x+585' vars = a vals = 2 [../]
+  [./f586] type = ParsedFunction value = 'a*x+586' vars = a vals = 2 [../]
+  [./f587] type = ParsedFunction value = 'a*x+587' vars = a vals = 2 [../]
+  [./f588] type = ParsedFunction value = 'a*x+588' vars = a vals = 2 [../]
+  [./f589] type = ParsedFunction value = 'a*x+589' vars = a vals = 2 [../]
+  [./f590] type = ParsedFunction value = 'a*x+590' vars = a vals = 2 [../]
+  [./f591] type = ParsedFunction value = 'a*x+591' vars = a vals = 2 [../]
+  [./f592] type = ParsedFunction value = 'a*x+592' vars = a vals = 2 [../]
+  [./f593] type = ParsedFunction value = 'a*x+593' vars = a vals = 2 [../]
+  [./f594] type = ParsedFunction value = 'a*x+594' vars = a vals = 2 [../]
+  [./f595] type = ParsedFunction value = 'a*x+595' vars = a vals = 2 [../]
+  [./f596] type = ParsedFunction value = 'a*x+596' vars = a vals = 2 [../]
+  [./f597] type = ParsedFunction value = 'a*x+597' vars = a vals = 2 [../]
+  [./f598] type = ParsedFunction value = 'a*x+598' vars = a vals = 2 [../]
+  [./f599] type = ParsedFunction value = 'a*x+599' vars = a vals = 2 [../]
+  [./f600] type = ParsedFunction value = 'a*x+600' vars = a vals = 2 [../]
+  [./f601] type = ParsedFunction value = 'a*x+601' vars = a vals = 2 [../]
+  [./f602] type = ParsedFunction value = 'a*x+602' vars = a vals = 2 [../]
+  [./f603] type = ParsedFunction value = 'a*x+603' vars = a vals = 2 [../]
+  [./f604] type = ParsedFunction value = 'a*x+604' vars = a vals = 2 [../]
+  [./f605] type = ParsedFunction value = 'a*x+605' vars = a vals = 2 [../]
+  [./f606] type = ParsedFunction value = 'a*x+606' vars = a vals = 2 [../]
+  [./f607] type = ParsedFunction value = 'a*x+607' vars = a vals = 2 [../]
+  [./f608] type = ParsedFunction value = 'a*x+608' vars = a vals = 2 [../]
+  [./f609] type = ParsedFunction value = 'a*x+609' vars = a vals = 2 [../]
+  [./f610] type = ParsedFunction value = 'a*x+610' vars = a vals = 2 [../]
+  [./f611] type = ParsedFunction value = 'a*x+611' vars = a vals = 2 [../]
+  [./f612] type = ParsedFunction value = 'a*x+612' vars = a vals = 2 [../]
+  [./f613] type = ParsedFunction value = 'a*x+613' vars = a vals = 2 [../]
+  [./f614] type = ParsedFunction value = 'a*x+614' vars = a vals = 2 [../]
+  [./f615] type = ParsedFunction value = 'a*x+615' vars = a vals = 2 [../]
+  [./f616] type = ParsedFunction value = 'a*x+616' vars = a vals = 2 [../]
+  [./f617] type = ParsedFunction value = 'a*x+617' vars = a vals = 2 [../]
+  [./f618] type = ParsedFunction value = 'a*x+618' vars = a vals = 2 [../]
+  [./f619] type = ParsedFunction value = 'a*x+619' vars = a vals = 2 [../]
+  [./f620] type = ParsedFunction value = 'a*x+620' vars = a vals = 2 [../]
+  [./f621] type = ParsedFunction value = 'a*x+621' vars = a vals = 2 [../]
+  [./f622] type = ParsedFunction value = 'a*x+622' vars = a vals = 2 [../]
+  [./f623] type = ParsedFunction value = 'a*x+623' vars = a vals = 2 [../]
+  [./f624] type = ParsedFunction value = 'a*x+624' vars = a vals = 2 [../]
+  [./f625] type = ParsedFunction value = 'a*x+625' vars = a vals = 2 [../]
+  [./f626] type = ParsedFunction value = 'a*x+626' vars = a vals = 2 [../]
+  [./f627] type = ParsedFunction value = 'a*x+627' vars = a vals = 2 [../]
+  [./f628] type = ParsedFunction value = 'a*x+628' vars = a vals = 2 [../]
+  [./f629] type = ParsedFunction value = 'a*x+629' vars = a vals = 2 [../]
+  [./f630] type = ParsedFunction value = 'a*x+630' vars = a vals = 2 [../]
+  [./f631] type = ParsedFunction value = 'a*x+631' vars = a vals = 2 [../]
+  [./f632] type = ParsedFunction value = 'a*x+632' vars = a vals = 2 [../]
+  [./f633] type = ParsedFunction value = 'a*x+633' vars = a vals = 2 [../]
+  [./f634] type = ParsedFunction value = 'a*x+634' vars = a vals = 2 [../]
+  [./f635] type = ParsedFunction value = 'a*x+635' vars = a vals = 2 [../]
+  [./f636] type = ParsedFunction value = 'a*x+636' vars = a vals = 2 [../]
+  [./f637] type = ParsedFunction value = 'a*x+637' vars = a vals = 2 [../]
+  [./f638] type = ParsedFunction value = 'a*x+638' vars = a vals = 2 [../]
+  [./f639] type = ParsedFunction value = 'a*x+639' vars = a vals = 2 [../]
+  [./f640] type = ParsedFunction value = 'a*x+640' vars = a vals = 2 [../]
+  [./f641] type = ParsedFunction value = 'a*x+641' vars = a vals = 2 [../]
+  [./f642] type = ParsedFunction value = 'a*x+642' vars = a vals = 2 [../]
+  [./f643] type = ParsedFunction value = 'a*x+643' vars = a vals = 2 [../]
+  [./f644] type = ParsedFunction value = 'a*x+644' vars = a vals = 2 [../]
+  [./f645] type = ParsedFunction value = 'a*x+645' vars = a vals = 2 [../]
+  [./f646] type = ParsedFunction value = 'a*x+646' vars = a vals = 2 [../]
+  [./f647] type = ParsedFunction value = 'a*x+647' vars = a vals = 2 [../]
+  [./f648] type = ParsedFunction value = 'a*x+648' vars = a vals = 2 [../]
+  [./f649] type = ParsedFunction value = 'a*x+649' vars = a vals = 2 [../]
+  [./f650] type = ParsedFunction value = 'a*x+650' vars = a vals = 2 [../]
+  [./f651] type = ParsedFunction value = 'a*x+651' vars = a vals = 2 [../]
+  [./f652] type = ParsedFunction value = 'a*x+652' vars = a vals = 2 [../]
+  [./f653] type = ParsedFunction value = 'a*x+653' vars = a vals = 2 [../]
+  [./f654] type = ParsedFunction value = 'a*x+654' vars = a vals = 2 [../]
+  [./f655] type = ParsedFunction value = 'a*x+655' vars = a vals = 2 [../]
+  [./f656] type = ParsedFunction value = 'a*x+656' vars = a vals = 2 [../]
+  [./f657] type = ParsedFunction value = 'a*x+657' vars = a vals = 2 [../]
+  [./f658] type = ParsedFunction value = 'a*x+658' vars = a vals = 2 [../]
+  [./f659] type = ParsedFunction value = 'a*x+659' vars = a vals = 2 [../]
+  [./f660] type = ParsedFunction value = 'a*x+660' vars = a vals = 2 [../]
+  [./f661] type = ParsedFunction value = 'a*x+661' vars = a vals = 2 [../]
+  [./f662] type = ParsedFunction value = 'a*x+662' vars = a vals = 2 [../]
+  [./f663] type = ParsedFunction value = 'a*x+663' vars = a vals = 2 [../]
+  [./f664] type = ParsedFunction value = 'a*x+664' vars = a vals = 2 [../]
+  [./f665] type = ParsedFunction value = 'a*x+665' vars = a vals = 2 [../]
+  [./f666] type = ParsedFunction value = 'a*x+666' vars = a vals = 2 [../]
+  [./f667] type = ParsedFunction value = 'a*x+667' vars = a vals = 2 [../]
+  [./f668] type = ParsedFunction value = 'a*x+668' vars = a vals = 2 [../]
+  [./f669] type = ParsedFunction value = 'a*x+669' vars = a vals = 2 [../]
+  [./f670] type = ParsedFunction value = 'a*x+670' vars = a vals = 2 [../]
+  [./f671] type = ParsedFunction value = 'a*x+671' vars = a vals = 2 [../]
+  [./f672] type = ParsedFunction value = 'a*x+672' vars = a vals = 2 [../]
+  [./f673] type = ParsedFunction value = 'a*x+673' vars = a vals = 2 [../]
+  [./f674] type = ParsedFunction value = 'a*x+674' vars = a vals = 2 [../]
+  [./f675] type = ParsedFunction value = 'a*x+675' vars = a vals = 2 [../]
+  [./f676] type = ParsedFunction value = 'a*x+676' vars = a vals = 2 [../]
+  [./f677] type = ParsedFunction value = 'a*x+677' vars = a vals = 2 [../]
+  [./f678] type = ParsedFunction value = 'a*x+678' vars = a vals = 2 [../]
+  [./f679] type = ParsedFunction value = 'a*x+679' vars = a vals = 2 [../]
+  [./f680] type = ParsedFunction value = 'a*x+680' vars = a vals = 2 [../]
+  [./f681] type = ParsedFunction value = 'a*x+681' vars = a vals = 2 [../]
+  [./f682] type = ParsedFunction value = 'a*x+682' vars = a vals = 2 [../]
+  [./f683] type = ParsedFunction value = 'a*x+683' vars = a vals = 2 [../]
+  [./f684] type = ParsedFunction value = 'a*x+684' vars = a vals = 2 [../]
+  [./f685] type = ParsedFunction value = 'a*x+685' vars = a vals = 2 [../]
+  [./f686] type = ParsedFunction value = 'a*x+686' vars = a vals = 2 [../]
+  [./f687] type = ParsedFunction value = 'a*x+687' vars = a vals = 2 [../]
+  [./f688] type = ParsedFunction value = 'a*x+688' vars = a vals = 2 [../]
+  [./f689] type = ParsedFunction value = 'a*x+689' vars = a vals = 2 [../]
+  [./f690] type = ParsedFunction value = 'a*x+690' vars = a vals = 2 [../]
+  [./f691] type = ParsedFunction value = 'a*x+691' vars = a vals = 2 [../]
+  [./f692] type = ParsedFunction value = 'a*x+692' vars = a vals = 2 [../]
+  [./f693] type = ParsedFunction value = 'a*x+693' vars = a vals = 2 [../]
+  [./f694] type = ParsedFunction value = 'a*x+694' vars = a vals = 2 [../]
+  [./f695] type = ParsedFunction value = 'a*x+695' vars = a vals = 2 [../]
+  [./f696] type = ParsedFunction value = 'a*x+696' vars = a vals = 2 [../]
+  [./f697] type = ParsedFunction value = 'a*x+697' vars = a vals = 2 [../]
+  [./f698] type = ParsedFunction value = 'a*x+698' vars = a vals = 2 [../]
+  [./f699] type = ParsedFunction value = 'a*x+699' vars = a vals = 2 [../]
+  [./f700] type = ParsedFunction value = 'a*x+700' vars = a vals = 2 [../]
+  [./f701] type = ParsedFunction value = 'a*x+701' vars = a vals = 2 [../]
+  [./f702] type = ParsedFunction value = 'a*x+702' vars = a vals = 2 [../]
+  [./f703] type = ParsedFunction value = 'a*x+703' vars = a vals = 2 [../]
+  [./f704] type = ParsedFunction value = 'a*x+704' vars = a vals = 2 [../]
+  [./f705] type = ParsedFunction value = 'a*x+705' vars = a vals = 2 [../]
+  [./f706] type = ParsedFunction value = 'a*x+706' vars = a vals = 2 [../]
+  [./f707] type = ParsedFunction value = 'a*x+707' vars = a vals = 2 [../]
+  [./f708] type = ParsedFunction value = 'a*x+708' vars = a vals = 2 [../]
+  [./f709] type = ParsedFunction value = 'a*x+709' vars = a vals = 2 [../]
+  [./f710] type = ParsedFunction value = 'a*x+710' vars = a vals = 2 [../]
+  [./f711] type = ParsedFunction value = 'a*x+711' vars = a vals = 2 [../]
+  [./f712] type = ParsedFunction value = 'a*x+712' vars = a vals = 2 [../]
+  [./f713] type = ParsedFunction value = 'a*x+713' vars = a vals = 2 [../]
+  [./f714] type = ParsedFunction value = 'a*x+714' vars = a vals = 2 [../]
+  [./f715] type = ParsedFunction value = 'a*x+715' vars = a vals = 2 [../]
+  [./f716] type = ParsedFunction value = 'a*x+716' vars = a vals = 2 [../]
+  [./f717] type = ParsedFunction value = 'a*x+717' vars = a vals = 2 [../]
+  [./f718] type = ParsedFunction value = 'a*x+718' vars = a vals = 2 [../]
+  [./f719] type = ParsedFunction value = 'a*x+719' vars = a vals = 2 [../]
+  [./f720] type = ParsedFunction value = 'a*x+720' vars = a vals = 2 [../]
+  [./f721] type = ParsedFunction value = 'a*x+721' vars = a vals = 2 [../]
+  [./f722] type = ParsedFunction value = 'a*x+722' vars = a vals = 2 [../]
+  [./f723] type = ParsedFunction value = 'a*x+723' vars = a vals = 2 [../]
+  [./f724] type = ParsedFunction value = 'a*x+724' vars = a vals = 2 [../]
+  [./f725] type = ParsedFunction value = 'a*x+725' vars = a vals = 2 [../]
+  [./f726] type = ParsedFunction value = 'a*x+726' vars = a vals = 2 [../]
+  [./f727] type = ParsedFunction value = 'a*x+727' vars = a vals = 2 [../]
+  [./f728] type = ParsedFunction value = 'a*x+728' vars = a vals = 2 [../]
+  [./f729] type = ParsedFunction value = 'a*x+729' vars = a vals = 2 [../]
+  [./f730] type = ParsedFunction value = 'a*x+730' vars = a vals = 2 [../]
+  [./f731] type = ParsedFunction value = 'a*x+731' vars = a vals = 2 [../]
+  [./f732] type = ParsedFunction value = 'a*x+732' vars = a vals = 2 [../]
+  [./f733] type = ParsedFunction value = 'a*x+733' vars = a vals = 2 [../]
+  [./f734] type = ParsedFunction value = 'a*x+734' vars = a vals = 2 [../]
+  [./f735] type = ParsedFunction value = 'a*x+735' vars = a vals = 2 [../]
+  [./f736] type = ParsedFunction value = 'a*x+736' vars = a vals = 2 [../]
+  [./f737] type = ParsedFunction value = 'a*x+737' vars = a vals = 2 [../]
+  [./f738] type = ParsedFunction value = 'a*x+738' vars = a vals = 2 [../]
+  [./f739] type = ParsedFunction value = 'a*x+739' vars = a vals = 2 [../]
+  [./f740] type = ParsedFunction value = 'a*x+740' vars = a vals = 2 [../]
+  [./f741] type = ParsedFunction value = 'a*x+741' vars = a vals = 2 [../]
+  [./f742] type = ParsedFunction value = 'a*x+742' vars = a vals = 2 [../]
+  [./f743] type = ParsedFunction value = 'a*x+743' vars = a vals = 2 [../]
+  [./f744] type = ParsedFunction value = 'a*x+744' vars = a vals = 2 [../]
+  [./f745] type = ParsedFunction value = 'a*x+745' vars = a vals = 2 [../]
+  [./f746] type = ParsedFunction value = 'a*x+746' vars = a vals = 2 [../]
+  [./f747] type = ParsedFunction value = 'a*x+747' vars = a vals = 2 [../]
+  [./f748] type = ParsedFunction value = 'a*x+748' vars = a vals = 2 [../]
+  [./f749] type = ParsedFunction value = 'a*x+749' vars = a vals = 2 [../]
+  [./f750] type = ParsedFunction value = 'a*x+750' vars = a vals = 2 [../]
+  [./f751] type = ParsedFunction value = 'a*x+751' vars = a vals = 2 [../]
+  [./f752] type = ParsedFunction value = 'a*x+752' vars = a vals = 2 [../]
+  [./f753] type = ParsedFunction value = 'a*x+753' vars = a vals = 2 [../]
+  [./f754] type = ParsedFunction value = 'a*x+754' vars = a vals = 2 [../]
+  [./f755] type = ParsedFunction value = 'a*x+755' vars = a vals = 2 [../]
+  [./f756] type = ParsedFunction value = 'a*x+756' vars = a vals = 2 [../]
+  [./f757] type = ParsedFunction value = 'a*x+757' vars = a vals = 2 [../]
+  [./f758] type = ParsedFunction value = 'a*x+758' vars = a vals = 2 [../]
+  [./f759] type = ParsedFunction value = 'a*x+759' vars = a vals = 2 [../]
+  [./f760] type = ParsedFunction value = 'a*x+760' vars = a vals = 2 [../]
+  [./f761] type = ParsedFunction value = 'a*x+761' vars = a vals = 2 [../]
+  [./f762] type = ParsedFunction value = 'a*x+762' vars = a vals = 2 [../]
+  [./f763] type = ParsedFunction value = 'a*x+763' vars = a vals = 2 [../]
+  [./f764] type = ParsedFunction value = 'a*x+764' vars = a vals = 2 [../]
+  [./f765] type = ParsedFunction value = 'a*x+765' vars = a vals = 2 [../]
+  [./f766] type = ParsedFunction value = 'a*x+766' vars = a vals = 2 [../]
+  [./f767] type = ParsedFunction value = 'a*x+767' vars = a vals = 2 [../]
+  [./f768] type = ParsedFunction value = 'a*x+768' vars = a vals = 2 [../]
+  [./f769] type = ParsedFunction value = 'a*x+769' vars = a vals = 2 [../]
+  [./f770] type = ParsedFunction value = 'a*x+770' vars = a vals = 2 [../]
+  [./f771] type = ParsedFunction value = 'a*x+771' vars = a vals = 2 [../]
+  [./f772] type = ParsedFunction value = 'a*x+772' vars = a vals = 2 [../]
+  [./f773] type = ParsedFunction value = 'a*x+773' vars = a vals = 2 [../]
+  [./f774] type = ParsedFunction value = 'a*x+774' vars = a vals = 2 [../]
+  [./f775] type = ParsedFunction value = 'a*x+775' vars = a vals = 2 [../]
+  [./f776] type = ParsedFunction value = 'a*x+776' vars = a vals = 2 [../]
+  [./f777] type = ParsedFunction value = 'a*x+777' vars = a vals = 2 [../]
+  [./f778] type = ParsedFunction value = 'a*x+778' vars = a vals = 2 [../]
+  [./f779] type = ParsedFunction value = 'a*x+779' vars = a vals = 2 [../]
+  [./f780] type = ParsedFunction value = 'a*x+780' vars = a vals = 2 [../]
+  [./f781] type = ParsedFunction value = 'a*x+781' vars = a vals = 2 [../]
+  [./f782] type = ParsedFunction value = 'a*x+782' vars = a vals = 2 [../]
+  [./f783] type = ParsedFunction value = 'a*x+783' vars = a vals = 2 [../]
+  [./f784] type = ParsedFunction value = 'a*x+784' vars = a vals = 2 [../]
+  [./f785] type = ParsedFunction value = 'a*x+785' vars = a vals = 2 [../]
+  [./f786] type = ParsedFunction value = 'a*x+786' vars = a vals = 2 [../]
+  [./f787] type = ParsedFunction value = 'a*x+787' vars = a vals = 2 [../]
+  [./f788] type = ParsedFunction value = 'a*x+788' vars = a vals = 2 [../]
+  [./f789] type = ParsedFunction value = 'a*x+789' vars = a vals = 2 [../]
+  [./f790] type = ParsedFunction value = 'a*x+790' vars = a vals = 2 [../]
+  [./f791] type = ParsedFunction value = 'a*x+791' vars = a vals = 2 [../]
+  [./f792] type = ParsedFunction value = 'a*x+792' vars = a vals = 2 [../]
+  [./f793] type = ParsedFunction value = 'a*x+793' vars = a vals = 2 [../]
+  [./f794] type = ParsedFunction value = 'a*x+794' vars = a vals = 2 [../]
+  [./f795] type = ParsedFunction value = 'a*x+795' vars = a vals = 2 [../]
+  [./f796] type = ParsedFunction value = 'a*x+796' vars = a vals = 2 [../]
+  [./f797] type = ParsedFunction value = 'a*x+797' vars = a vals = 2 [../]
+  [./f798] type = ParsedFunction value = 'a*x+798' vars = a vals = 2 [../]
+  [./f799] type = ParsedFunction value = 'a*x+799' vars = a vals = 2 [../]
+  [./f800] type = ParsedFunction value = 'a*x+800' vars = a vals = 2 [../]
+  [./f801] type = ParsedFunction value = 'a*x+801' vars = a vals = 2 [../]
+  [./f802] type = ParsedFunction value = 'a*x+802' vars = a vals = 2 [../]
+  [./f803] type = ParsedFunction value = 'a*x+803' vars = a vals = 2 [../]
+  [./f804] type = ParsedFunction value = 'a*x+804' vars = a vals = 2 [../]
+  [./f805] type = ParsedFunction value = 'a*x+805' vars = a vals = 2 [../]
+  [./f806] type = ParsedFunction value = 'a*x+806' vars = a vals = 2 [../]
+  [./f807] type = ParsedFunction value = 'a*x+807' vars = a vals = 2 [../]
+  [./f808] type = ParsedFunction value = 'a*x+808' vars = a vals = 2 [../]
+  [./f809] type = ParsedFunction value = 'a*x+809' vars = a vals = 2 [../]
+  [./f810] type = ParsedFunction value = 'a*x+810' vars = a vals = 2 [../]
+  [./f811] type = ParsedFunction value = 'a*x+811' vars = a vals = 2 [../]
+  [./f812] type = ParsedFunction value = 'a*x+812' vars = a vals = 2 [../]
+  [./f813] type = ParsedFunction value = 'a*x+813' vars = a vals = 2 [../]
+  [./f814] type = ParsedFunction value = 'a*x+814' vars = a vals = 2 [../]
+  [./f815] type = ParsedFunction value = 'a*x+815' vars = a vals = 2 [../]
+  [./f816] type = ParsedFunction value = 'a*x+816' vars = a vals = 2 [../]
+  [./f817] type = ParsedFunction value = 'a*x+817' vars = a vals = 2 [../]
+  [./f818] type = ParsedFunction value = 'a*x+818' vars = a vals = 2 [../]
+  [./f819] type = ParsedFunction value = 'a*x+819' vars = a vals = 2 [../]
+  [./f820] type = ParsedFunction value = 'a*x+820' vars = a vals = 2 [../]
+  [./f821] type = ParsedFunction value = 'a*x+821' vars = a vals = 2 [../]
+  [./f822] type = ParsedFunction value = 'a*x+822' vars = a vals = 2 [../]
+  [./f823] type = ParsedFunction value = 'a*x+823' vars = a vals = 2 [../]
+  [./f824] type = ParsedFunction value = 'a*x+824' vars = a vals = 2 [../]
+  [./f825] type = ParsedFunction value = 'a*x+825' vars = a vals = 2 [../]
+  [./f826] type = ParsedFunction value = 'a*x+826' vars = a vals = 2 [../]
+  [./f827] type = ParsedFunction value = 'a*x+827' vars = a vals = 2 [../]
+  [./f828] type = ParsedFunction value = 'a*x+828' vars = a vals = 2 [../]
+  [./f829] type = ParsedFunction value = 'a*x+829' vars = a vals = 2 [../]
+  [./f830] type = ParsedFunction value = 'a*x+830' vars = a vals = 2 [../]
+  [./f831] type = ParsedFunction value = 'a*x+831' vars = a vals = 2 [../]
+  [./f832] type = ParsedFunction value = 'a*x+832' vars = a vals = 2 [../]
+  [./f833] type = ParsedFunction value = 'a*x+833' vars = a vals = 2 [../]
+  [./f834] type = ParsedFunction value = 'a*x+834' vars = a vals = 2 [../]
+  [./f835] type = ParsedFunction value = 'a*x+835' vars = a vals = 2 [../]
+  [./f836] type = ParsedFunction value = 'a*x+836' vars = a vals = 2 [../]
+  [./f837] type = ParsedFunction value = 'a*x+837' vars = a vals = 2 [../]
+  [./f838] type = ParsedFunction value = 'a*x+838' vars = a vals = 2 [../]
+  [./f839] type = ParsedFunction value = 'a*x+839' vars = a vals = 2 [../]
+  [./f840] type = ParsedFunction value = 'a*x+840' vars = a vals = 2 [../]
+  [./f841] type = ParsedFunction value = 'a*x+841' vars = a vals = 2 [../]
+  [./f842] type = ParsedFunction value = 'a*x+842' vars = a vals = 2 [../]
+  [./f843] type = ParsedFunction value = 'a*x+843' vars = a vals = 2 [../]
+  [./f844] type = ParsedFunction value = 'a*x+844' vars = a vals = 2 [../]
+  [./f845] type = ParsedFunction value = 'a*x+845' vars = a vals = 2 [../]
+  [./f846] type = ParsedFunction value = 'a*x+846' vars = a vals = 2 [../]
+  [./f847] type = ParsedFunction value = 'a*x+847' vars = a vals = 2 [../]
+  [./f848] type = ParsedFunction value = 'a*x+848' vars = a vals = 2 [../]
+  [./f849] type = ParsedFunction value = 'a*x+849' vars = a vals = 2 [../]
+  [./f850] type = ParsedFunction value = 'a*x+850' vars = a vals = 2 [../]
+  [./f851] type = ParsedFunction value = 'a*x+851' vars = a vals = 2 [../]
+  [./f852] type = ParsedFunction value = 'a*x+852' vars = a vals = 2 [../]
+  [./f853] type = ParsedFunction value = 'a*x+853' vars = a vals = 2 [../]
+  [./f854] type = ParsedFunction value = 'a*x+854' vars = a vals = 2 [../]
+  [./f855] type = ParsedFunction value = 'a*x+855' vars = a vals = 2 [../]
+  [./f856] type = ParsedFunction value = 'a*x+856' vars = a vals = 2 [../]
+  [./f857] type = ParsedFunction value = 'a*x+857' vars = a vals = 2 [../]
+  [./f858] type = ParsedFunction value = 'a*x+858' vars = a vals = 2 [../]
+  [./f859] type = ParsedFunction value = 'a*x+859' vars = a vals = 2 [../]
+  [./f860] type = ParsedFunction value = 'a*x+860' vars = a vals = 2 [../]
+  [./f861] type = ParsedFunction value = 'a*x+861' vars = a vals = 2 [../]
+  [./f862] type = ParsedFunction value = 'a*x+862' vars = a vals = 2 [../]
+  [./f863] type = ParsedFunction value = 'a*x+863' vars = a vals = 2 [../]
+  [./f864] type = ParsedFunction value = 'a*x+864' vars = a vals = 2 [../]
+  [./f865] type = ParsedFunction value = 'a*x+865' vars = a vals = 2 [../]
+  [./f866] type = ParsedFunction value = 'a*x+866' vars = a vals = 2 [../]
+  [./f867] type = ParsedFunction value = 'a*x+867' vars = a vals = 2 [../]
+  [./f868] type = ParsedFunction value = 'a*x+868' vars = a vals = 2 [../]
+  [./f869] type = ParsedFunction value = 'a*x+869' vars = a vals = 2 [../]
+  [./f870] type = ParsedFunction value = 'a*x+870' vars = a vals = 2 [../]
+  [./f871] type = ParsedFunction value = 'a*x+871' vars = a vals = 2 [../]
+  [./f872] type = ParsedFunction value = 'a*x+872' vars = a vals = 2 [../]
+  [./f873] type = ParsedFunction value = 'a*x+873' vars = a vals = 2 [../]
+  [./f874] type = ParsedFunction value = 'a*x+874' vars = a vals = 2 [../]
+  [./f875] type = ParsedFunction value = 'a*x+875' vars = a vals = 2 [../]
+  [./f876] type = ParsedFunction value = 'a*x+876' vars = a vals = 2 [../]
+  [./f877] type = ParsedFunction value = 'a*x+877' vars = a vals = 2 [../]
+  [./f878] type = ParsedFunction value = 'a*x+878' vars = a vals = 2 [../]
+  [./f879] type = ParsedFunction value = 'a*x+879' vars = a vals = 2 [../]
+  [./f880] type = ParsedFunction value = 'a*x+880' vars = a vals = 2 [../]
+  [./f881] type = ParsedFunction value = 'a*x+881' vars = a vals = 2 [../]
+  [./f882] type = ParsedFunction value = 'a*x+882' vars = a vals = 2 [../]
+  [./f883] type = ParsedFunction value = 'a*x+883' vars = a vals = 2 [../]
+  [./f884] type = ParsedFunction value = 'a*x+884' vars = a vals = 2 [../]
+  [./f885] type = ParsedFunction value = 'a*x+885' vars = a vals = 2 [../]
+  [./f886] type = ParsedFunction value = 'a*x+886' vars = a vals = 2 [../]
+  [./f887] type = ParsedFunction value = 'a*x+887' vars = a vals = 2 [../]
+  [./f888] type = ParsedFunction value = 'a*x+888' vars = a vals = 2 [../]
+  [./f889] type = ParsedFunction value = 'a*x+889' vars = a vals = 2 [../]
+  [./f890] type = ParsedFunction value = 'a*x+890' vars = a vals = 2 [../]
+  [./f891] type = ParsedFunction value = 'a*x+891' vars = a vals = 2 [../]
+  [./f892] type = ParsedFunction value = 'a*x+892' vars = a vals = 2 [../]
+  [./f893] type = ParsedFunction value = 'a*x+893' vars = a vals = 2 [../]
+  [./f894] type = ParsedFunction value = 'a*x+894' vars = a vals = 2 [../]
+  [./f895] type = ParsedFunction value = 'a*x+895' vars = a vals = 2 [../]
+  [./f896] type = ParsedFunction value = 'a*x+896' vars = a vals = 2 [../]
+  [./f897] type = ParsedFunction value = 'a*x+897' vars = a vals = 2 [../]
+  [./f898] type = ParsedFunction value = 'a*x+898' vars = a vals = 2 [../]
+  [./f899] type = ParsedFunction value = 'a*x+899' vars = a vals = 2 [../]
+  [./f900] type = ParsedFunction value = 'a*x+900' vars = a vals = 2 [../]
+  [./f901] type = ParsedFunction value = 'a*x+901' vars = a vals = 2 [../]
+  [./f902] type = ParsedFunction value = 'a*x+902' vars = a vals = 2 [../]
+  [./f903] type = ParsedFunction value = 'a*x+903' vars = a vals = 2 [../]
+  [./f904] type = ParsedFunction value = 'a*x+904' vars = a vals = 2 [../]
+  [./f905] type = ParsedFunction value = 'a*x+905' vars = a vals = 2 [../]
+  [./f906] type = ParsedFunction value = 'a*x+906' vars = a vals = 2 [../]
+  [./f907] type = ParsedFunction value = 'a*x+907' vars = a vals = 2 [../]
+  [./f908] type = ParsedFunction value = 'a*x+908' vars = a vals = 2 [../]
+  [./f909] type = ParsedFunction value = 'a*x+909' vars = a vals = 2 [../]
+  [./f910] type = ParsedFunction value = 'a*x+910' vars = a vals = 2 [../]
+  [./f911] type = ParsedFunction value = 'a*x+911' vars = a vals = 2 [../]
+  [./f912] type = ParsedFunction value = 'a*x+912' vars = a vals = 2 [../]
+  [./f913] type = ParsedFunction value = 'a*x+913' vars = a vals = 2 [../]
+  [./f914] type = ParsedFunction value = 'a*x+914' vars = a vals = 2 [../]
+  [./f915] type = ParsedFunction value = 'a*x+915' vars = a vals = 2 [../]
+  [./f916] type = ParsedFunction value = 'a*x+916' vars = a vals = 2 [../]
+  [./f917] type = ParsedFunction value = 'a*x+917' vars = a vals = 2 [../]
+  [./f918] type = ParsedFunction value = 'a*x+918' vars = a vals = 2 [../]
+  [./f919] type = ParsedFunction value = 'a*x+919' vars = a vals = 2 [../]
+  [./f920] type = ParsedFunction value = 'a*x+920' vars = a vals = 2 [../]
+  [./f921] type = ParsedFunction value = 'a*x+921' vars = a vals = 2 [../]
+  [./f922] type = ParsedFunction value = 'a*x+922' vars = a vals = 2 [../]
+  [./f923] type = ParsedFunction value = 'a*x+923' vars = a vals = 2 [../]
+  [./f924] type = ParsedFunction value = 'a*x+924' vars = a vals = 2 [../]
+  [./f925] type = ParsedFunction value = 'a*x+925' vars = a vals = 2 [../]
+  [./f926] type = ParsedFunction value = 'a*x+926' vars = a vals = 2 [../]
+  [./f927] type = ParsedFunction value = 'a*x+927' vars = a vals = 2 [../]
+  [./f928] type = ParsedFunction value = 'a*x+928' vars = a vals = 2 [../]
+  [./f929] type = ParsedFunction value = 'a*x+929' vars = a vals = 2 [../]
+  [./f930] type = ParsedFunction value = 'a*x+930' vars = a vals = 2 [../]
+  [./f931] type = ParsedFunction value = 'a*x+931' vars = a vals = 2 [../]
+  [./f932] type = ParsedFunction value = 'a*x+932' vars = a vals = 2 [../]
+  [./f933] type = ParsedFunction value = 'a*x+933' vars = a vals = 2 [../]
+  [./f934] type = ParsedFunction value = 'a*x+934' vars = a vals = 2 [../]
+  [./f935] type = ParsedFunction value = 'a*x+935' vars = a vals = 2 [../]
+  [./f936] type = ParsedFunction value = 'a*x+936' vars = a vals = 2 [../]
+  [./f937] type = ParsedFunction value = 'a*x+937' vars = a vals = 2 [../]
+  [./f938] type = ParsedFunction value = 'a*x+938' vars = a vals = 2 [../]
+  [./f939] type = ParsedFunction value = 'a*x+939' vars = a vals = 2 [../]
+  [./f940] type = ParsedFunction value = 'a*x+940' vars = a vals = 2 [../]
+  [./f941] type = ParsedFunction value = 'a*x+941' vars = a vals = 2 [../]
+  [./f942] type = ParsedFunction value = 'a*x+942' vars = a vals = 2 [../]
+  [./f943] type = ParsedFunction value = 'a*x+943' vars = a vals = 2 [../]
+  [./f944] type = ParsedFunction value = 'a*x+944' vars = a vals = 2 [../]
+  [./f945] type = ParsedFunction value = 'a*x+945' vars = a vals = 2 [../]
+  [./f946] type = ParsedFunction value = 'a*x+946' vars = a vals = 2 [../]
+  [./f947] type = ParsedFunction value = 'a*x+947' vars = a vals = 2 [../]
+  [./f948] type = ParsedFunction value = 'a*x+948' vars = a vals = 2 [../]
+  [./f949] type = ParsedFunction value = 'a*x+949' vars = a vals = 2 [../]
+  [./f950] type = ParsedFunction value = 'a*x+950' vars = a vals = 2 [../]
+  [./f951] type = ParsedFunction value = 'a*x+951' vars = a vals = 2 [../]
+  [./f952] type = ParsedFunction value = 'a*x+952' vars = a vals = 2 [../]
+  [./f953] type = ParsedFunction value = 'a*x+953' vars = a vals = 2 [../]
+  [./f954] type = ParsedFunction value = 'a*x+954' vars = a vals = 2 [../]
+  [./f955] type = ParsedFunction value = 'a*x+955' vars = a vals = 2 [../]
+  [./f956] type = ParsedFunction value = 'a*x+956' vars = a vals = 2 [../]
+  [./f957] type = ParsedFunction value = 'a*x+957' vars = a vals = 2 [../]
+  [./f958] type = ParsedFunction value = 'a*x+958' vars = a vals = 2 [../]
+  [./f959] type = ParsedFunction value = 'a*x+959' vars = a vals = 2 [../]
+  [./f960] type = ParsedFunction value = 'a*x+960' vars = a vals = 2 [../]
+  [./f961] type = ParsedFunction value = 'a*x+961' vars = a vals = 2 [../]
+  [./f962] type = ParsedFunction value = 'a*x+962' vars = a vals = 2 [../]
+  [./f963] type = ParsedFunction value = 'a*x+963' vars = a vals = 2 [../]
+  [./f964] type = ParsedFunction value = 'a*x+964' vars = a vals = 2 [../]
+  [./f965] type = ParsedFunction value = 'a*x+965' vars = a vals = 2 [../]
+  [./f966] type = ParsedFunction value = 'a*x+966' vars = a vals = 2 [../]
+  [./f967] type = ParsedFunction value = 'a*x+967' vars = a vals = 2 [../]
+  [./f968] type = ParsedFunction value = 'a*x+968' vars = a vals = 2 [../]
+  [./f969] type = ParsedFunction value = 'a*x+969' vars = a vals = 2 [../]
+  [./f970] type = ParsedFunction value = 'a*x+970' vars = a vals = 2 [../]
+  [./f971] type = ParsedFunction value = 'a*x+971' vars = a vals = 2 [../]
+  [./f972] type = ParsedFunction value = 'a*x+972' vars = a vals = 2 [../]
+  [./f973] type = ParsedFunction value = 'a*x+973' vars = a vals = 2 [../]
+  [./f974] type = ParsedFunction value = 'a*x+974' vars = a vals = 2 [../]
+  [./f975] type = ParsedFunction value = 'a*x+975' vars = a vals = 2 [../]
+  [./f976] type = ParsedFunction value = 'a*x+976' vars = a vals = 2 [../]
+  [./f977] type = ParsedFunction value = 'a*x+977' vars = a vals = 2 [../]
+  [./f978] type = ParsedFunction value = 'a*x+978' vars = a vals = 2 [../]
+  [./f979] type = ParsedFunction value = 'a*x+979' vars = a vals = 2 [../]
+  [./f980] type = ParsedFunction value = 'a*x+980' vars = a vals = 2 [../]
+  [./f981] type = ParsedFunction value = 'a*x+981' vars = a vals = 2 [../]
+  [./f982] type = ParsedFunction value = 'a*x+982' vars = a vals = 2 [../]
+  [./f983] type = ParsedFunction value = 'a*x+983' vars = a vals = 2 [../]
+  [./f984] type = ParsedFunction value = 'a*x+984' vars = a vals = 2 [../]
+  [./f985] type = ParsedFunction value = 'a*x+985' vars = a vals = 2 [../]
+  [./f986] type = ParsedFunction value = 'a*x+986' vars = a vals = 2 [../]
+  [./f987] type = ParsedFunction value = 'a*x+987' vars = a vals = 2 [../]
+  [./f988] type = ParsedFunction value = 'a*x+988' vars = a vals = 2 [../]
+  [./f989] type = ParsedFunction value = 'a*x+989' vars = a vals = 2 [../]
+  [./f990] type = ParsedFunction value = 'a*x+990' vars = a vals = 2 [../]
+  [./f991] type = ParsedFunction value = 'a*x+991' vars = a vals = 2 [../]
+  [./f992] type = ParsedFunction value = 'a*x+992' vars = a vals = 2 [../]
+  [./f993] type = ParsedFunction value = 'a*x+993' vars = a vals = 2 [../]
+  [./f994] type = ParsedFunction value = 'a*x+994' vars = a vals = 2 [../]
+  [./f995] type = ParsedFunction value = 'a*x+995' vars = a vals = 2 [../]
+  [./f996] type = ParsedFunction value = 'a*x+996' vars = a vals = 2 [../]
+  [./f997] type = ParsedFunction value = 'a*x+997' vars = a vals = 2 [../]
+  [./f998] type = ParsedFunction value = 'a*x+998' vars = a vals = 2 [../]
+  [./f999] type = ParsedFunction value = 'a*x+999' vars = a vals = 2 [../]
+[]
+
+[Postprocessors]
+  [./pp0] type = FunctionValuePostprocessor function = f0 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp1] type = FunctionValuePostprocessor function = f1 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp2] type = FunctionValuePostprocessor function = f2 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp3] type = FunctionValuePostprocessor function = f3 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp4] type = FunctionValuePostprocessor function = f4 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp5] type = FunctionValuePostprocessor function = f5 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp6] type = FunctionValuePostprocessor function = f6 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp7] type = FunctionValuePostprocessor function = f7 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp8] type = FunctionValuePostprocessor function = f8 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp9] type = FunctionValuePostprocessor function = f9 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp10] type = FunctionValuePostprocessor function = f10 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp11] type = FunctionValuePostprocessor function = f11 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp12] type = FunctionValuePostprocessor function = f12 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp13] type = FunctionValuePostprocessor function = f13 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp14] type = FunctionValuePostprocessor function = f14 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp15] type = FunctionValuePostprocessor function = f15 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp16] type = FunctionValuePostprocessor function = f16 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp17] type = FunctionValuePostprocessor function = f17 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp18] type = FunctionValuePostprocessor function = f18 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp19] type = FunctionValuePostprocessor function = f19 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp20] type = FunctionValuePostprocessor function = f20 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp21] type = FunctionValuePostprocessor function = f21 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp22] type = FunctionValuePostprocessor function = f22 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp23] type = FunctionValuePostprocessor function = f23 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp24] type = FunctionValuePostprocessor function = f24 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp25] type = FunctionValuePostprocessor function = f25 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp26] type = FunctionValuePostprocessor function = f26 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp27] type = FunctionValuePostprocessor function = f27 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp28] type = FunctionValuePostprocessor function = f28 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp29] type = FunctionValuePostprocessor function = f29 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp30] type = FunctionValuePostprocessor function = f30 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp31] type = FunctionValuePostprocessor function = f31 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp32] type = FunctionValuePostprocessor function = f32 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp33] type = FunctionValuePostprocessor function = f33 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp34] type = FunctionValuePostprocessor function = f34 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp35] type = FunctionValuePostprocessor function = f35 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp36] type = FunctionValuePostprocessor function = f36 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp37] type = FunctionValuePostprocessor function = f37 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp38] type = FunctionValuePostprocessor function = f38 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp39] type = FunctionValuePostprocessor function = f39 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp40] type = FunctionValuePostprocessor function = f40 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp41] type = FunctionValuePostprocessor function = f41 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp42] type = FunctionValuePostprocessor function = f42 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp43] type = FunctionValuePostprocessor function = f43 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp44] type = FunctionValuePostprocessor function = f44 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp45] type = FunctionValuePostprocessor function = f45 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp46] type = FunctionValuePostprocessor function = f46 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp47] type = FunctionValuePostprocessor function = f47 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp48] type = FunctionValuePostprocessor function = f48 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp49] type = FunctionValuePostprocessor function = f49 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp50] type = FunctionValuePostprocessor function = f50 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp51] type = FunctionValuePostprocessor function = f51 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp52] type = FunctionValuePostprocessor function = f52 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp53] type = FunctionValuePostprocessor function = f53 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp54] type = FunctionValuePostprocessor function = f54 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp55] type = FunctionValuePostprocessor function = f55 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp56] type = FunctionValuePostprocessor function = f56 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp57] type = FunctionValuePostprocessor function = f57 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp58] type = FunctionValuePostprocessor function = f58 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp59] type = FunctionValuePostprocessor function = f59 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp60] type = FunctionValuePostprocessor function = f60 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp61] type = FunctionValuePostprocessor function = f61 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp62] type = FunctionValuePostprocessor function = f62 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp63] type = FunctionValuePostprocessor function = f63 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp64] type = FunctionValuePostprocessor function = f64 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp65] type = FunctionValuePostprocessor function = f65 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp66] type = FunctionValuePostprocessor function = f66 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp67] type = FunctionValuePostprocessor function = f67 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp68] type = FunctionValuePostprocessor function = f68 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp69] type = FunctionValuePostprocessor function = f69 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp70] type = FunctionValuePostprocessor function = f70 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp71] type = FunctionValuePostprocessor function = f71 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp72] type = FunctionValuePostprocessor function = f72 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp73] type = FunctionValuePostprocessor function = f73 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp74] type = FunctionValuePostprocessor function = f74 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp75] type = FunctionValuePostprocessor function = f75 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp76] type = FunctionValuePostprocessor function = f76 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp77] type = FunctionValuePostprocessor function = f77 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp78] type = FunctionValuePostprocessor function = f78 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp79] type = FunctionValuePostprocessor function = f79 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp80] type = FunctionValuePostprocessor function = f80 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp81] type = FunctionValuePostprocessor function = f81 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp82] type = FunctionValuePostprocessor function = f82 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp83] type = FunctionValuePostprocessor function = f83 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp84] type = FunctionValuePostprocessor function = f84 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp85] type = FunctionValuePostprocessor function = f85 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp86] type = FunctionValuePostprocessor function = f86 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp87] type = FunctionValuePostprocessor function = f87 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp88] type = FunctionValuePostprocessor function = f88 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp89] type = FunctionValuePostprocessor function = f89 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp90] type = FunctionValuePostprocessor function = f90 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp91] type = FunctionValuePostprocessor function = f91 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp92] type = FunctionValuePostprocessor function = f92 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp93] type = FunctionValuePostprocessor function = f93 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp94] type = FunctionValuePostprocessor function = f94 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp95] type = FunctionValuePostprocessor function = f95 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp96] type = FunctionValuePostprocessor function = f96 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp97] type = FunctionValuePostprocessor function = f97 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp98] type = FunctionValuePostprocessor function = f98 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp99] type = FunctionValuePostprocessor function = f99 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp100] type = FunctionValuePostprocessor function = f100 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp101] type = FunctionValuePostprocessor function = f101 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp102] type = FunctionValuePostprocessor function = f102 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp103] type = FunctionValuePostprocessor function = f103 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp104] type = FunctionValuePostprocessor function = f104 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp105] type = FunctionValuePostprocessor function = f105 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp106] type = FunctionValuePostprocessor function = f106 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp107] type = FunctionValuePostprocessor function = f107 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp108] type = FunctionValuePostprocessor function = f108 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp109] type = FunctionValuePostprocessor function = f109 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp110] type = FunctionValuePostprocessor function = f110 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp111] type = FunctionValuePostprocessor function = f111 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp112] type = FunctionValuePostprocessor function = f112 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp113] type = FunctionValuePostprocessor function = f113 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp114] type = FunctionValuePostprocessor function = f114 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp115] type = FunctionValuePostprocessor function = f115 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp116] type = FunctionValuePostprocessor function = f116 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp117] type = FunctionValuePostprocessor function = f117 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp118] type = FunctionValuePostprocessor function = f118 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp119] type = FunctionValuePostprocessor function = f119 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp120] type = FunctionValuePostprocessor function = f120 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp121] type = FunctionValuePostprocessor function = f121 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp122] type = FunctionValuePostprocessor function = f122 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp123] type = FunctionValuePostprocessor function = f123 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp124] type = FunctionValuePostprocessor function = f124 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp125] type = FunctionValuePostprocessor function = f125 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp126] type = FunctionValuePostprocessor function = f126 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp127] type = FunctionValuePostprocessor function = f127 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp128] type = FunctionValuePostprocessor function = f128 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp129] type = FunctionValuePostprocessor function = f129 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp130] type = FunctionValuePostprocessor function = f130 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp131] type = FunctionValuePostprocessor function = f131 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp132] type = FunctionValuePostprocessor function = f132 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp133] type = FunctionValuePostprocessor function = f133 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp134] type = FunctionValuePostprocessor function = f134 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp135] type = FunctionValuePostprocessor function = f135 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp136] type = FunctionValuePostprocessor function = f136 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp137] type = FunctionValuePostprocessor function = f137 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp138] type = FunctionValuePostprocessor function = f138 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp139] type = FunctionValuePostprocessor function = f139 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp140] type = FunctionValuePostprocessor function = f140 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp141] type = FunctionValuePostprocessor function = f141 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp142] type = FunctionValuePostprocessor function = f142 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp143] type = FunctionValuePostprocessor function = f143 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp144] type = FunctionValuePostprocessor function = f144 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp145] type = FunctionValuePostprocessor function = f145 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp146] type = FunctionValuePostprocessor function = f146 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp147] type = FunctionValuePostprocessor function = f147 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp148] type = FunctionValuePostprocessor function = f148 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp149] type = FunctionValuePostprocessor function = f149 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp150] type = FunctionValuePostprocessor function = f150 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp151] type = FunctionValuePostprocessor function = f151 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp152] type = FunctionValuePostprocessor function = f152 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp153] type = FunctionValuePostprocessor function = f153 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp154] type = FunctionValuePostprocessor function = f154 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp155] type = FunctionValuePostprocessor function = f155 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp156] type = FunctionValuePostprocessor function = f156 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp157] type = FunctionValuePostprocessor function = f157 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp158] type = FunctionValuePostprocessor function = f158 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp159] type = FunctionValuePostprocessor function = f159 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp160] type = FunctionValuePostprocessor function = f160 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp161] type = FunctionValuePostprocessor function = f161 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp162] type = FunctionValuePostprocessor function = f162 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp163] type = FunctionValuePostprocessor function = f163 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp164] type = FunctionValuePostprocessor function = f164 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp165] type = FunctionValuePostprocessor function = f165 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp166] type = FunctionValuePostprocessor function = f166 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp167] type = FunctionValuePostprocessor function = f167 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp168] type = FunctionValuePostprocessor function = f168 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp169] type = FunctionValuePostprocessor function = f169 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp170] type = FunctionValuePostprocessor function = f170 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp171] type = FunctionValuePostprocessor function = f171 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp172] type = FunctionValuePostprocessor function = f172 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp173] type = FunctionValuePostprocessor function = f173 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp174] type = FunctionValuePostprocessor function = f174 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp175] type = FunctionValuePostprocessor function = f175 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp176] type = FunctionValuePostprocessor function = f176 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp177] type = FunctionValuePostprocessor function = f177 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp178] type = FunctionValuePostprocessor function = f178 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp179] type = FunctionValuePostprocessor function = f179 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp180] type = FunctionValuePostprocessor function = f180 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp181] type = FunctionValuePostprocessor function = f181 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp182] type = FunctionValuePostprocessor function = f182 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp183] type = FunctionValuePostprocessor function = f183 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp184] type = FunctionValuePostprocessor function = f184 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp185] type = FunctionValuePostprocessor function = f185 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp186] type = FunctionValuePostprocessor function = f186 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp187] type = FunctionValuePostprocessor function = f187 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp188] type = FunctionValuePostprocessor function = f188 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp189] type = FunctionValuePostprocessor function = f189 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp190] type = FunctionValuePostprocessor function = f190 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp191] type = FunctionValuePostprocessor function = f191 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp192] type = FunctionValuePostprocessor function = f192 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp193] type = FunctionValuePostprocessor function = f193 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp194] type = FunctionValuePostprocessor function = f194 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp195] type = FunctionValuePostprocessor function = f195 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp196] type = FunctionValuePostprocessor function = f196 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp197] type = FunctionValuePostprocessor function = f197 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp198] type = FunctionValuePostprocessor function = f198 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp199] type = FunctionValuePostprocessor function = f199 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp200] type = FunctionValuePostprocessor function = f200 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp201] type = FunctionValuePostprocessor function = f201 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp202] type = FunctionValuePostprocessor function = f202 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp203] type = FunctionValuePostprocessor function = f203 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp204] type = FunctionValuePostprocessor function = f204 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp205] type = FunctionValuePostprocessor function = f205 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp206] type = FunctionValuePostprocessor function = f206 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp207] type = FunctionValuePostprocessor function = f207 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp208] type = FunctionValuePostprocessor function = f208 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp209] type = FunctionValuePostprocessor function = f209 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp210] type = FunctionValuePostprocessor function = f210 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp211] type = FunctionValuePostprocessor function = f211 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp212] type = FunctionValuePostprocessor function = f212 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp213] type = FunctionValuePostprocessor function = f213 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp214] type = FunctionValuePostprocessor function = f214 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp215] type = FunctionValuePostprocessor function = f215 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp216] type = FunctionValuePostprocessor function = f216 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp217] type = FunctionValuePostprocessor function = f217 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp218] type = FunctionValuePostprocessor function = f218 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp219] type = FunctionValuePostprocessor function = f219 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp220] type = FunctionValuePostprocessor function = f220 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp221] type = FunctionValuePostprocessor function = f221 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp222] type = FunctionValuePostprocessor function = f222 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp223] type = FunctionValuePostprocessor function = f223 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp224] type = FunctionValuePostprocessor function = f224 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp225] type = FunctionValuePostprocessor function = f225 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp226] type = FunctionValuePostprocessor function = f226 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp227] type = FunctionValuePostprocessor function = f227 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp228] type = FunctionValuePostprocessor function = f228 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp229] type = FunctionValuePostprocessor function = f229 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp230] type = FunctionValuePostprocessor function = f230 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp231] type = FunctionValuePostprocessor function = f231 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp232] type = FunctionValuePostprocessor function = f232 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp233] type = FunctionValuePostprocessor function = f233 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp234] type = FunctionValuePostprocessor function = f234 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp235] type = FunctionValuePostprocessor function = f235 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp236] type = FunctionValuePostprocessor function = f236 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp237] type = FunctionValuePostprocessor function = f237 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp238] type = FunctionValuePostprocessor function = f238 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp239] type = FunctionValuePostprocessor function = f239 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp240] type = FunctionValuePostprocessor function = f240 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp241] type = FunctionValuePostprocessor function = f241 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp242] type = FunctionValuePostprocessor function = f242 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp243] type = FunctionValuePostprocessor function = f243 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp244] type = FunctionValuePostprocessor function = f244 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp245] type = FunctionValuePostprocessor function = f245 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp246] type = FunctionValuePostprocessor function = f246 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp247] type = FunctionValuePostprocessor function = f247 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp248] type = FunctionValuePostprocessor function = f248 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp249] type = FunctionValuePostprocessor function = f249 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp250] type = FunctionValuePostprocessor function = f250 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp251] type = FunctionValuePostprocessor function = f251 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp252] type = FunctionValuePostprocessor function = f252 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp253] type = FunctionValuePostprocessor function = f253 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp254] type = FunctionValuePostprocessor function = f254 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp255] type = FunctionValuePostprocessor function = f255 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp256] type = FunctionValuePostprocessor function = f256 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp257] type = FunctionValuePostprocessor function = f257 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp258] type = FunctionValuePostprocessor function = f258 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp259] type = FunctionValuePostprocessor function = f259 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp260] type = FunctionValuePostprocessor function = f260 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp261] type = FunctionValuePostprocessor function = f261 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp262] type = FunctionValuePostprocessor function = f262 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp263] type = FunctionValuePostprocessor function = f263 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp264] type = FunctionValuePostprocessor function = f264 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp265] type = FunctionValuePostprocessor function = f265 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp266] type = FunctionValuePostprocessor function = f266 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp267] type = FunctionValuePostprocessor function = f267 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp268] type = FunctionValuePostprocessor function = f268 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp269] type = FunctionValuePostprocessor function = f269 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp270] type = FunctionValuePostprocessor function = f270 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp271] type = FunctionValuePostprocessor function = f271 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp272] type = FunctionValuePostprocessor function = f272 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp273] type = FunctionValuePostprocessor function = f273 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp274] type = FunctionValuePostprocessor function = f274 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp275] type = FunctionValuePostprocessor function = f275 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp276] type = FunctionValuePostprocessor function = f276 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp277] type = FunctionValuePostprocessor function = f277 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp278] type = FunctionValuePostprocessor function = f278 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp279] type = FunctionValuePostprocessor function = f279 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp280] type = FunctionValuePostprocessor function = f280 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp281] type = FunctionValuePostprocessor function = f281 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp282] type = FunctionValuePostprocessor function = f282 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp283] type = FunctionValuePostprocessor function = f283 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp284] type = FunctionValuePostprocessor function = f284 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp285] type = FunctionValuePostprocessor function = f285 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp286] type = FunctionValuePostprocessor function = f286 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp287] type = FunctionValuePostprocessor function = f287 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp288] type = FunctionValuePostprocessor function = f288 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp289] type = FunctionValuePostprocessor function = f289 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp290] type = FunctionValuePostprocessor function = f290 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp291] type = FunctionValuePostprocessor function = f291 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp292] type = FunctionValuePostprocessor function = f292 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp293] type = FunctionValuePostprocessor function = f293 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp294] type = FunctionValuePostprocessor function = f294 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp295] type = FunctionValuePostprocessor function = f295 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp296] type = FunctionValuePostprocessor function = f296 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp297] type = FunctionValuePostprocessor function = f297 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp298] type = FunctionValuePostprocessor function = f298 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp299] type = FunctionValuePostprocessor function = f299 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp300] type = FunctionValuePostprocessor function = f300 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp301] type = FunctionValuePostprocessor function = f301 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp302] type = FunctionValuePostprocessor function = f302 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp303] type = FunctionValuePostprocessor function = f303 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp304] type = FunctionValuePostprocessor function = f304 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp305] type = FunctionValuePostprocessor function = f305 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp306] type = FunctionValuePostprocessor function = f306 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp307] type = FunctionValuePostprocessor function = f307 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp308] type = FunctionValuePostprocessor function = f308 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp309] type = FunctionValuePostprocessor function = f309 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp310] type = FunctionValuePostprocessor function = f310 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp311] type = FunctionValuePostprocessor function = f311 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp312] type = FunctionValuePostprocessor function = f312 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp313] type = FunctionValuePostprocessor function = f313 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp314] type = FunctionValuePostprocessor function = f314 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp315] type = FunctionValuePostprocessor function = f315 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp316] type = FunctionValuePostprocessor function = f316 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp317] type = FunctionValuePostprocessor function = f317 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp318] type = FunctionValuePostprocessor function = f318 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp319] type = FunctionValuePostprocessor function = f319 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp320] type = FunctionValuePostprocessor function = f320 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp321] type = FunctionValuePostprocessor function = f321 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp322] type = FunctionValuePostprocessor function = f322 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp323] type = FunctionValuePostprocessor function = f323 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp324] type = FunctionValuePostprocessor function = f324 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp325] type = FunctionValuePostprocessor function = f325 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp326] type = FunctionValuePostprocessor function = f326 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp327] type = FunctionValuePostprocessor function = f327 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp328] type = FunctionValuePostprocessor function = f328 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp329] type = FunctionValuePostprocessor function = f329 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp330] type = FunctionValuePostprocessor function = f330 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp331] type = FunctionValuePostprocessor function = f331 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp332] type = FunctionValuePostprocessor function = f332 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp333] type = FunctionValuePostprocessor function = f333 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp334] type = FunctionValuePostprocessor function = f334 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp335] type = FunctionValuePostprocessor function = f335 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp336] type = FunctionValuePostprocessor function = f336 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp337] type = FunctionValuePostprocessor function = f337 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp338] type = FunctionValuePostprocessor function = f338 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp339] type = FunctionValuePostprocessor function = f339 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp340] type = FunctionValuePostprocessor function = f340 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp341] type = FunctionValuePostprocessor function = f341 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp342] type = FunctionValuePostprocessor function = f342 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp343] type = FunctionValuePostprocessor function = f343 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp344] type = FunctionValuePostprocessor function = f344 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp345] type = FunctionValuePostprocessor function = f345 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp346] type = FunctionValuePostprocessor function = f346 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp347] type = FunctionValuePostprocessor function = f347 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp348] type = FunctionValuePostprocessor function = f348 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp349] type = FunctionValuePostprocessor function = f349 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp350] type = FunctionValuePostprocessor function = f350 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp351] type = FunctionValuePostprocessor function = f351 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp352] type = FunctionValuePostprocessor function = f352 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp353] type = FunctionValuePostprocessor function = f353 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp354] type = FunctionValuePostprocessor function = f354 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp355] type = FunctionValuePostprocessor function = f355 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp356] type = FunctionValuePostprocessor function = f356 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp357] type = FunctionValuePostprocessor function = f357 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp358] type = FunctionValuePostprocessor function = f358 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp359] type = FunctionValuePostprocessor function = f359 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp360] type = FunctionValuePostprocessor function = f360 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp361] type = FunctionValuePostprocessor function = f361 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp362] type = FunctionValuePostprocessor function = f362 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp363] type = FunctionValuePostprocessor function = f363 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp364] type = FunctionValuePostprocessor function = f364 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp365] type = FunctionValuePostprocessor function = f365 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp366] type = FunctionValuePostprocessor function = f366 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp367] type = FunctionValuePostprocessor function = f367 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp368] type = FunctionValuePostprocessor function = f368 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp369] type = FunctionValuePostprocessor function = f369 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp370] type = FunctionValuePostprocessor function = f370 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp371] type = FunctionValuePostprocessor function = f371 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp372] type = FunctionValuePostprocessor function = f372 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp373] type = FunctionValuePostprocessor function = f373 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp374] type = FunctionValuePostprocessor function = f374 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp375] type = FunctionValuePostprocessor function = f375 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp376] type = FunctionValuePostprocessor function = f376 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp377] type = FunctionValuePostprocessor function = f377 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp378] type = FunctionValuePostprocessor function = f378 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp379] type = FunctionValuePostprocessor function = f379 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp380] type = FunctionValuePostprocessor function = f380 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp381] type = FunctionValuePostprocessor function = f381 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp382] type = FunctionValuePostprocessor function = f382 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp383] type = FunctionValuePostprocessor function = f383 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp384] type = FunctionValuePostprocessor function = f384 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp385] type = FunctionValuePostprocessor function = f385 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp386] type = FunctionValuePostprocessor function = f386 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp387] type = FunctionValuePostprocessor function = f387 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp388] type = FunctionValuePostprocessor function = f388 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp389] type = FunctionValuePostprocessor function = f389 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp390] type = FunctionValuePostprocessor function = f390 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp391] type = FunctionValuePostprocessor function = f391 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp392] type = FunctionValuePostprocessor function = f392 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp393] type = FunctionValuePostprocessor function = f393 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp394] type = FunctionValuePostprocessor function = f394 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp395] type = FunctionValuePostprocessor function = f395 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp396] type = FunctionValuePostprocessor function = f396 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp397] type = FunctionValuePostprocessor function = f397 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp398] type = FunctionValuePostprocessor function = f398 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp399] type = FunctionValuePostprocessor function = f399 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp400] type = FunctionValuePostprocessor function = f400 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp401] type = FunctionValuePostprocessor function = f401 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp402] type = FunctionValuePostprocessor function = f402 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp403] type = FunctionValuePostprocessor function = f403 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp404] type = FunctionValuePostprocessor function = f404 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp405] type = FunctionValuePostprocessor function = f405 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp406] type = FunctionValuePostprocessor function = f406 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp407] type = FunctionValuePostprocessor function = f407 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp408] type = FunctionValuePostprocessor function = f408 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp409] type = FunctionValuePostprocessor function = f409 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp410] type = FunctionValuePostprocessor function = f410 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp411] type = FunctionValuePostprocessor function = f411 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp412] type = FunctionValuePostprocessor function = f412 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp413] type = FunctionValuePostprocessor function = f413 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp414] type = FunctionValuePostprocessor function = f414 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp415] type = FunctionValuePostprocessor function = f415 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp416] type = FunctionValuePostprocessor function = f416 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp417] type = FunctionValuePostprocessor function = f417 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp418] type = FunctionValuePostprocessor function = f418 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp419] type = FunctionValuePostprocessor function = f419 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp420] type = FunctionValuePostprocessor function = f420 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp421] type = FunctionValuePostprocessor function = f421 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp422] type = FunctionValuePostprocessor function = f422 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp423] type = FunctionValuePostprocessor function = f423 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp424] type = FunctionValuePostprocessor function = f424 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp425] type = FunctionValuePostprocessor function = f425 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp426] type = FunctionValuePostprocessor function = f426 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp427] type = FunctionValuePostprocessor function = f427 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp428] type = FunctionValuePostprocessor function = f428 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp429] type = FunctionValuePostprocessor function = f429 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp430] type = FunctionValuePostprocessor function = f430 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp431] type = FunctionValuePostprocessor function = f431 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp432] type = FunctionValuePostprocessor function = f432 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp433] type = FunctionValuePostprocessor function = f433 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp434] type = FunctionValuePostprocessor function = f434 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp435] type = FunctionValuePostprocessor function = f435 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp436] type = FunctionValuePostprocessor function = f436 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp437] type = FunctionValuePostprocessor function = f437 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp438] type = FunctionValuePostprocessor function = f438 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp439] type = FunctionValuePostprocessor function = f439 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp440] type = FunctionValuePostprocessor function = f440 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp441] type = FunctionValuePostprocessor function = f441 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp442] type = FunctionValuePostprocessor function = f442 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp443] type = FunctionValuePostprocessor function = f443 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp444] type = FunctionValuePostprocessor function = f444 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp445] type = FunctionValuePostprocessor function = f445 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp446] type = FunctionValuePostprocessor function = f446 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp447] type = FunctionValuePostprocessor function = f447 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp448] type = FunctionValuePostprocessor function = f448 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp449] type = FunctionValuePostprocessor function = f449 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp450] type = FunctionValuePostprocessor function = f450 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp451] type = FunctionValuePostprocessor function = f451 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp452] type = FunctionValuePostprocessor function = f452 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp453] type = FunctionValuePostprocessor function = f453 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp454] type = FunctionValuePostprocessor function = f454 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp455] type = FunctionValuePostprocessor function = f455 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp456] type = FunctionValuePostprocessor function = f456 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp457] type = FunctionValuePostprocessor function = f457 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp458] type = FunctionValuePostprocessor function = f458 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp459] type = FunctionValuePostprocessor function = f459 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp460] type = FunctionValuePostprocessor function = f460 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp461] type = FunctionValuePostprocessor function = f461 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp462] type = FunctionValuePostprocessor function = f462 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp463] type = FunctionValuePostprocessor function = f463 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp464] type = FunctionValuePostprocessor function = f464 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp465] type = FunctionValuePostprocessor function = f465 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp466] type = FunctionValuePostprocessor function = f466 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp467] type = FunctionValuePostprocessor function = f467 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp468] type = FunctionValuePostprocessor function = f468 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp469] type = FunctionValuePostprocessor function = f469 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp470] type = FunctionValuePostprocessor function = f470 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp471] type = FunctionValuePostprocessor function = f471 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp472] type = FunctionValuePostprocessor function = f472 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp473] type = FunctionValuePostprocessor function = f473 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp474] type = FunctionValuePostprocessor function = f474 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp475] type = FunctionValuePostprocessor function = f475 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp476] type = FunctionValuePostprocessor function = f476 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp477] type = FunctionValuePostprocessor function = f477 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp478] type = FunctionValuePostprocessor function = f478 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp479] type = FunctionValuePostprocessor function = f479 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp480] type = FunctionValuePostprocessor function = f480 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp481] type = FunctionValuePostprocessor function = f481 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp482] type = FunctionValuePostprocessor function = f482 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp483] type = FunctionValuePostprocessor function = f483 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp484] type = FunctionValuePostprocessor function = f484 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp485] type = FunctionValuePostprocessor function = f485 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp486] type = FunctionValuePostprocessor function = f486 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp487] type = FunctionValuePostprocessor function = f487 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp488] type = FunctionValuePostprocessor function = f488 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp489] type = FunctionValuePostprocessor function = f489 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp490] type = FunctionValuePostprocessor function = f490 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp491] type = FunctionValuePostprocessor function = f491 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp492] type = FunctionValuePostprocessor function = f492 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp493] type = FunctionValuePostprocessor function = f493 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp494] type = FunctionValuePostprocessor function = f494 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp495] type = FunctionValuePostprocessor function = f495 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp496] type = FunctionValuePostprocessor function = f496 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp497] type = FunctionValuePostprocessor function = f497 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp498] type = FunctionValuePostprocessor function = f498 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp499] type = FunctionValuePostprocessor function = f499 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp500] type = FunctionValuePostprocessor function = f500 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp501] type = FunctionValuePostprocessor function = f501 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp502] type = FunctionValuePostprocessor function = f502 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp503] type = FunctionValuePostprocessor function = f503 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp504] type = FunctionValuePostprocessor function = f504 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp505] type = FunctionValuePostprocessor function = f505 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp506] type = FunctionValuePostprocessor function = f506 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp507] type = FunctionValuePostprocessor function = f507 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp508] type = FunctionValuePostprocessor function = f508 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp509] type = FunctionValuePostprocessor function = f509 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp510] type = FunctionValuePostprocessor function = f510 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp511] type = FunctionValuePostprocessor function = f511 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp512] type = FunctionValuePostprocessor function = f512 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp513] type = FunctionValuePostprocessor function = f513 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp514] type = FunctionValuePostprocessor function = f514 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp515] type = FunctionValuePostprocessor function = f515 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp516] type = FunctionValuePostprocessor function = f516 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp517] type = FunctionValuePostprocessor function = f517 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp518] type = FunctionValuePostprocessor function = f518 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp519] type = FunctionValuePostprocessor function = f519 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp520] type = FunctionValuePostprocessor function = f520 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp521] type = FunctionValuePostprocessor function = f521 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp522] type = FunctionValuePostprocessor function = f522 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp523] type = FunctionValuePostprocessor function = f523 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp524] type = FunctionValuePostprocessor function = f524 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp525] type = FunctionValuePostprocessor function = f525 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp526] type = FunctionValuePostprocessor function = f526 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp527] type = FunctionValuePostprocessor function = f527 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp528] type = FunctionValuePostprocessor function = f528 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp529] type = FunctionValuePostprocessor function = f529 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp530] type = FunctionValuePostprocessor function = f530 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp531] type = FunctionValuePostprocessor function = f531 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp532] type = FunctionValuePostprocessor function = f532 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp533] type = FunctionValuePostprocessor function = f533 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp534] type = FunctionValuePostprocessor function = f534 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp535] type = FunctionValuePostprocessor function = f535 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp536] type = FunctionValuePostprocessor function = f536 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp537] type = FunctionValuePostprocessor function = f537 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp538] type = FunctionValuePostprocessor function = f538 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp539] type = FunctionValuePostprocessor function = f539 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp540] type = FunctionValuePostprocessor function = f540 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp541] type = FunctionValuePostprocessor function = f541 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp542] type = FunctionValuePostprocessor function = f542 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp543] type = FunctionValuePostprocessor function = f543 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp544] type = FunctionValuePostprocessor function = f544 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp545] type = FunctionValuePostprocessor function = f545 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp546] type = FunctionValuePostprocessor function = f546 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp547] type = FunctionValuePostprocessor function = f547 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp548] type = FunctionValuePostprocessor function = f548 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp549] type = FunctionValuePostprocessor function = f549 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp550] type = FunctionValuePostprocessor function = f550 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp551] type = FunctionValuePostprocessor function = f551 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp552] type = FunctionValuePostprocessor function = f552 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp553] type = FunctionValuePostprocessor function = f553 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp554] type = FunctionValuePostprocessor function = f554 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp555] type = FunctionValuePostprocessor function = f555 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp556] type = FunctionValuePostprocessor function = f556 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp557] type = FunctionValuePostprocessor function = f557 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp558] type = FunctionValuePostprocessor function = f558 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp559] type = FunctionValuePostprocessor function = f559 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp560] type = FunctionValuePostprocessor function = f560 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp561] type = FunctionValuePostprocessor function = f561 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp562] type = FunctionValuePostprocessor function = f562 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp563] type = FunctionValuePostprocessor function = f563 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp564] type = FunctionValuePostprocessor function = f564 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp565] type = FunctionValuePostprocessor function = f565 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp566] type = FunctionValuePostprocessor function = f566 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp567] type = FunctionValuePostprocessor function = f567 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp568] type = FunctionValuePostprocessor function = f568 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp569] type = FunctionValuePostprocessor function = f569 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp570] type = FunctionValuePostprocessor function = f570 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp571] type = FunctionValuePostprocessor function = f571 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp572] type = FunctionValuePostprocessor function = f572 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp573] type = FunctionValuePostprocessor function = f573 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp574] type = FunctionValuePostprocessor function = f574 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp575] type = FunctionValuePostprocessor function = f575 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp576] type = FunctionValuePostprocessor function = f576 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp577] type = FunctionValuePostprocessor function = f577 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp578] type = FunctionValuePostprocessor function = f578 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp579] type = FunctionValuePostprocessor function = f579 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp580] type = FunctionValuePostprocessor function = f580 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp581] type = FunctionValuePostprocessor function = f581 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp582] type = FunctionValuePostprocessor function = f582 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp583] type = FunctionValuePostprocessor function = f583 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp584] type = FunctionValuePostprocessor function = f584 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp585] type = FunctionValuePostprocessor function = f585 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp586] type = FunctionValuePostprocessor function = f586 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp587] type = FunctionValuePostprocessor function = f587 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp588] type = FunctionValuePostprocessor function = f588 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp589] type = FunctionValuePostprocessor function = f589 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp590] type = FunctionValuePostprocessor function = f590 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp591] type = FunctionValuePostprocessor function = f591 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp592] type = FunctionValuePostprocessor function = f592 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp593] type = FunctionValuePostprocessor function = f593 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp594] type = FunctionValuePostprocessor function = f594 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp595] type = FunctionValuePostprocessor function = f595 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp596] type = FunctionValuePostprocessor function = f596 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp597] type = FunctionValuePostprocessor function = f597 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp598] type = FunctionValuePostprocessor function = f598 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp599] type = FunctionValuePostprocessor function = f599 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp600] type = FunctionValuePostprocessor function = f600 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp601] type = FunctionValuePostprocessor function = f601 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp602] type = FunctionValuePostprocessor function = f602 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp603] type = FunctionValuePostprocessor function = f603 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp604] type = FunctionValuePostprocessor function = f604 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp605] type = FunctionValuePostprocessor function = f605 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp606] type = FunctionValuePostprocessor function = f606 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp607] type = FunctionValuePostprocessor function = f607 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp608] type = FunctionValuePostprocessor function = f608 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp609] type = FunctionValuePostprocessor function = f609 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp610] type = FunctionValuePostprocessor function = f610 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp611] type = FunctionValuePostprocessor function = f611 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp612] type = FunctionValuePostprocessor function = f612 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp613] type = FunctionValuePostprocessor function = f613 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp614] type = FunctionValuePostprocessor function = f614 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp615] type = FunctionValuePostprocessor function = f615 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp616] type = FunctionValuePostprocessor function = f616 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp617] type = FunctionValuePostprocessor function = f617 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp618] type = FunctionValuePostprocessor function = f618 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp619] type = FunctionValuePostprocessor function = f619 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp620] type = FunctionValuePostprocessor function = f620 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp621] type = FunctionValuePostprocessor function = f621 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp622] type = FunctionValuePostprocessor function = f622 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp623] type = FunctionValuePostprocessor function = f623 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp624] type = FunctionValuePostprocessor function = f624 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp625] type = FunctionValuePostprocessor function = f625 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp626] type = FunctionValuePostprocessor function = f626 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp627] type = FunctionValuePostprocessor function = f627 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp628] type = FunctionValuePostprocessor function = f628 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp629] type = FunctionValuePostprocessor function = f629 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp630] type = FunctionValuePostprocessor function = f630 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp631] type = FunctionValuePostprocessor function = f631 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp632] type = FunctionValuePostprocessor function = f632 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp633] type = FunctionValuePostprocessor function = f633 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp634] type = FunctionValuePostprocessor function = f634 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp635] type = FunctionValuePostprocessor function = f635 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp636] type = FunctionValuePostprocessor function = f636 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp637] type = FunctionValuePostprocessor function = f637 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp638] type = FunctionValuePostprocessor function = f638 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp639] type = FunctionValuePostprocessor function = f639 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp640] type = FunctionValuePostprocessor function = f640 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp641] type = FunctionValuePostprocessor function = f641 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp642] type = FunctionValuePostprocessor function = f642 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp643] type = FunctionValuePostprocessor function = f643 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp644] type = FunctionValuePostprocessor function = f644 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp645] type = FunctionValuePostprocessor function = f645 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp646] type = FunctionValuePostprocessor function = f646 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp647] type = FunctionValuePostprocessor function = f647 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp648] type = FunctionValuePostprocessor function = f648 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp649] type = FunctionValuePostprocessor function = f649 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp650] type = FunctionValuePostprocessor function = f650 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp651] type = FunctionValuePostprocessor function = f651 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp652] type = FunctionValuePostprocessor function = f652 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp653] type = FunctionValuePostprocessor function = f653 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp654] type = FunctionValuePostprocessor function = f654 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp655] type = FunctionValuePostprocessor function = f655 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp656] type = FunctionValuePostprocessor function = f656 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp657] type = FunctionValuePostprocessor function = f657 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp658] type = FunctionValuePostprocessor function = f658 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp659] type = FunctionValuePostprocessor function = f659 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp660] type = FunctionValuePostprocessor function = f660 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp661] type = FunctionValuePostprocessor function = f661 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp662] type = FunctionValuePostprocessor function = f662 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp663] type = FunctionValuePostprocessor function = f663 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp664] type = FunctionValuePostprocessor function = f664 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp665] type = FunctionValuePostprocessor function = f665 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp666] type = FunctionValuePostprocessor function = f666 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp667] type = FunctionValuePostprocessor function = f667 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp668] type = FunctionValuePostprocessor function = f668 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp669] type = FunctionValuePostprocessor function = f669 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp670] type = FunctionValuePostprocessor function = f670 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp671] type = FunctionValuePostprocessor function = f671 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp672] type = FunctionValuePostprocessor function = f672 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp673] type = FunctionValuePostprocessor function = f673 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp674] type = FunctionValuePostprocessor function = f674 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp675] type = FunctionValuePostprocessor function = f675 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp676] type = FunctionValuePostprocessor function = f676 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp677] type = FunctionValuePostprocessor function = f677 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp678] type = FunctionValuePostprocessor function = f678 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp679] type = FunctionValuePostprocessor function = f679 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp680] type = FunctionValuePostprocessor function = f680 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp681] type = FunctionValuePostprocessor function = f681 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp682] type = FunctionValuePostprocessor function = f682 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp683] type = FunctionValuePostprocessor function = f683 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp684] type = FunctionValuePostprocessor function = f684 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp685] type = FunctionValuePostprocessor function = f685 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp686] type = FunctionValuePostprocessor function = f686 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp687] type = FunctionValuePostprocessor function = f687 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp688] type = FunctionValuePostprocessor function = f688 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp689] type = FunctionValuePostprocessor function = f689 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp690] type = FunctionValuePostprocessor function = f690 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp691] type = FunctionValuePostprocessor function = f691 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp692] type = FunctionValuePostprocessor function = f692 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp693] type = FunctionValuePostprocessor function = f693 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp694] type = FunctionValuePostprocessor function = f694 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp695] type = FunctionValuePostprocessor function = f695 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp696] type = FunctionValuePostprocessor function = f696 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp697] type = FunctionValuePostprocessor function = f697 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp698] type = FunctionValuePostprocessor function = f698 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp699] type = FunctionValuePostprocessor function = f699 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp700] type = FunctionValuePostprocessor function = f700 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp701] type = FunctionValuePostprocessor function = f701 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp702] type = FunctionValuePostprocessor function = f702 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp703] type = FunctionValuePostprocessor function = f703 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp704] type = FunctionValuePostprocessor function = f704 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp705] type = FunctionValuePostprocessor function = f705 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp706] type = FunctionValuePostprocessor function = f706 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp707] type = FunctionValuePostprocessor function = f707 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp708] type = FunctionValuePostprocessor function = f708 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp709] type = FunctionValuePostprocessor function = f709 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp710] type = FunctionValuePostprocessor function = f710 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp711] type = FunctionValuePostprocessor function = f711 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp712] type = FunctionValuePostprocessor function = f712 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp713] type = FunctionValuePostprocessor function = f713 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp714] type = FunctionValuePostprocessor function = f714 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp715] type = FunctionValuePostprocessor function = f715 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp716] type = FunctionValuePostprocessor function = f716 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp717] type = FunctionValuePostprocessor function = f717 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp718] type = FunctionValuePostprocessor function = f718 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp719] type = FunctionValuePostprocessor function = f719 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp720] type = FunctionValuePostprocessor function = f720 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp721] type = FunctionValuePostprocessor function = f721 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp722] type = FunctionValuePostprocessor function = f722 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp723] type = FunctionValuePostprocessor function = f723 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp724] type = FunctionValuePostprocessor function = f724 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp725] type = FunctionValuePostprocessor function = f725 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp726] type = FunctionValuePostprocessor function = f726 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp727] type = FunctionValuePostprocessor function = f727 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp728] type = FunctionValuePostprocessor function = f728 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp729] type = FunctionValuePostprocessor function = f729 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp730] type = FunctionValuePostprocessor function = f730 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp731] type = FunctionValuePostprocessor function = f731 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp732] type = FunctionValuePostprocessor function = f732 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp733] type = FunctionValuePostprocessor function = f733 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp734] type = FunctionValuePostprocessor function = f734 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp735] type = FunctionValuePostprocessor function = f735 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp736] type = FunctionValuePostprocessor function = f736 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp737] type = FunctionValuePostprocessor function = f737 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp738] type = FunctionValuePostprocessor function = f738 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp739] type = FunctionValuePostprocessor function = f739 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp740] type = FunctionValuePostprocessor function = f740 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp741] type = FunctionValuePostprocessor function = f741 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp742] type = FunctionValuePostprocessor function = f742 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp743] type = FunctionValuePostprocessor function = f743 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp744] type = FunctionValuePostprocessor function = f744 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp745] type = FunctionValuePostprocessor function = f745 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp746] type = FunctionValuePostprocessor function = f746 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp747] type = FunctionValuePostprocessor function = f747 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp748] type = FunctionValuePostprocessor function = f748 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp749] type = FunctionValuePostprocessor function = f749 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp750] type = FunctionValuePostprocessor function = f750 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp751] type = FunctionValuePostprocessor function = f751 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp752] type = FunctionValuePostprocessor function = f752 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp753] type = FunctionValuePostprocessor function = f753 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp754] type = FunctionValuePostprocessor function = f754 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp755] type = FunctionValuePostprocessor function = f755 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp756] type = FunctionValuePostprocessor function = f756 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp757] type = FunctionValuePostprocessor function = f757 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp758] type = FunctionValuePostprocessor function = f758 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp759] type = FunctionValuePostprocessor function = f759 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp760] type = FunctionValuePostprocessor function = f760 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp761] type = FunctionValuePostprocessor function = f761 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp762] type = FunctionValuePostprocessor function = f762 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp763] type = FunctionValuePostprocessor function = f763 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp764] type = FunctionValuePostprocessor function = f764 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp765] type = FunctionValuePostprocessor function = f765 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp766] type = FunctionValuePostprocessor function = f766 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp767] type = FunctionValuePostprocessor function = f767 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp768] type = FunctionValuePostprocessor function = f768 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp769] type = FunctionValuePostprocessor function = f769 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp770] type = FunctionValuePostprocessor function = f770 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp771] type = FunctionValuePostprocessor function = f771 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp772] type = FunctionValuePostprocessor function = f772 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp773] type = FunctionValuePostprocessor function = f773 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp774] type = FunctionValuePostprocessor function = f774 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp775] type = FunctionValuePostprocessor function = f775 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp776] type = FunctionValuePostprocessor function = f776 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp777] type = FunctionValuePostprocessor function = f777 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp778] type = FunctionValuePostprocessor function = f778 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp779] type = FunctionValuePostprocessor function = f779 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp780] type = FunctionValuePostprocessor function = f780 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp781] type = FunctionValuePostprocessor function = f781 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp782] type = FunctionValuePostprocessor function = f782 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp783] type = FunctionValuePostprocessor function = f783 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp784] type = FunctionValuePostprocessor function = f784 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp785] type = FunctionValuePostprocessor function = f785 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp786] type = FunctionValuePostprocessor function = f786 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp787] type = FunctionValuePostprocessor function = f787 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp788] type = FunctionValuePostprocessor function = f788 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp789] type = FunctionValuePostprocessor function = f789 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp790] type = FunctionValuePostprocessor function = f790 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp791] type = FunctionValuePostprocessor function = f791 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp792] type = FunctionValuePostprocessor function = f792 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp793] type = FunctionValuePostprocessor function = f793 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp794] type = FunctionValuePostprocessor function = f794 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp795] type = FunctionValuePostprocessor function = f795 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp796] type = FunctionValuePostprocessor function = f796 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp797] type = FunctionValuePostprocessor function = f797 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp798] type = FunctionValuePostprocessor function = f798 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp799] type = FunctionValuePostprocessor function = f799 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp800] type = FunctionValuePostprocessor function = f800 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp801] type = FunctionValuePostprocessor function = f801 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp802] type = FunctionValuePostprocessor function = f802 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp803] type = FunctionValuePostprocessor function = f803 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp804] type = FunctionValuePostprocessor function = f804 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp805] type = FunctionValuePostprocessor function = f805 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp806] type = FunctionValuePostprocessor function = f806 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp807] type = FunctionValuePostprocessor function = f807 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp808] type = FunctionValuePostprocessor function = f808 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp809] type = FunctionValuePostprocessor function = f809 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp810] type = FunctionValuePostprocessor function = f810 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp811] type = FunctionValuePostprocessor function = f811 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp812] type = FunctionValuePostprocessor function = f812 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp813] type = FunctionValuePostprocessor function = f813 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp814] type = FunctionValuePostprocessor function = f814 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp815] type = FunctionValuePostprocessor function = f815 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp816] type = FunctionValuePostprocessor function = f816 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp817] type = FunctionValuePostprocessor function = f817 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp818] type = FunctionValuePostprocessor function = f818 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp819] type = FunctionValuePostprocessor function = f819 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp820] type = FunctionValuePostprocessor function = f820 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp821] type = FunctionValuePostprocessor function = f821 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp822] type = FunctionValuePostprocessor function = f822 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp823] type = FunctionValuePostprocessor function = f823 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp824] type = FunctionValuePostprocessor function = f824 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp825] type = FunctionValuePostprocessor function = f825 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp826] type = FunctionValuePostprocessor function = f826 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp827] type = FunctionValuePostprocessor function = f827 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp828] type = FunctionValuePostprocessor function = f828 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp829] type = FunctionValuePostprocessor function = f829 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp830] type = FunctionValuePostprocessor function = f830 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp831] type = FunctionValuePostprocessor function = f831 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp832] type = FunctionValuePostprocessor function = f832 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp833] type = FunctionValuePostprocessor function = f833 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp834] type = FunctionValuePostprocessor function = f834 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp835] type = FunctionValuePostprocessor function = f835 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp836] type = FunctionValuePostprocessor function = f836 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp837] type = FunctionValuePostprocessor function = f837 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp838] type = FunctionValuePostprocessor function = f838 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp839] type = FunctionValuePostprocessor function = f839 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp840] type = FunctionValuePostprocessor function = f840 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp841] type = FunctionValuePostprocessor function = f841 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp842] type = FunctionValuePostprocessor function = f842 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp843] type = FunctionValuePostprocessor function = f843 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp844] type = FunctionValuePostprocessor function = f844 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp845] type = FunctionValuePostprocessor function = f845 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp846] type = FunctionValuePostprocessor function = f846 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp847] type = FunctionValuePostprocessor function = f847 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp848] type = FunctionValuePostprocessor function = f848 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp849] type = FunctionValuePostprocessor function = f849 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp850] type = FunctionValuePostprocessor function = f850 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp851] type = FunctionValuePostprocessor function = f851 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp852] type = FunctionValuePostprocessor function = f852 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp853] type = FunctionValuePostprocessor function = f853 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp854] type = FunctionValuePostprocessor function = f854 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp855] type = FunctionValuePostprocessor function = f855 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp856] type = FunctionValuePostprocessor function = f856 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp857] type = FunctionValuePostprocessor function = f857 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp858] type = FunctionValuePostprocessor function = f858 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp859] type = FunctionValuePostprocessor function = f859 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp860] type = FunctionValuePostprocessor function = f860 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp861] type = FunctionValuePostprocessor function = f861 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp862] type = FunctionValuePostprocessor function = f862 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp863] type = FunctionValuePostprocessor function = f863 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp864] type = FunctionValuePostprocessor function = f864 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp865] type = FunctionValuePostprocessor function = f865 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp866] type = FunctionValuePostprocessor function = f866 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp867] type = FunctionValuePostprocessor function = f867 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp868] type = FunctionValuePostprocessor function = f868 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp869] type = FunctionValuePostprocessor function = f869 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp870] type = FunctionValuePostprocessor function = f870 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp871] type = FunctionValuePostprocessor function = f871 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp872] type = FunctionValuePostprocessor function = f872 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp873] type = FunctionValuePostprocessor function = f873 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp874] type = FunctionValuePostprocessor function = f874 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp875] type = FunctionValuePostprocessor function = f875 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp876] type = FunctionValuePostprocessor function = f876 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp877] type = FunctionValuePostprocessor function = f877 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp878] type = FunctionValuePostprocessor function = f878 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp879] type = FunctionValuePostprocessor function = f879 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp880] type = FunctionValuePostprocessor function = f880 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp881] type = FunctionValuePostprocessor function = f881 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp882] type = FunctionValuePostprocessor function = f882 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp883] type = FunctionValuePostprocessor function = f883 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp884] type = FunctionValuePostprocessor function = f884 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp885] type = FunctionValuePostprocessor function = f885 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp886] type = FunctionValuePostprocessor function = f886 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp887] type = FunctionValuePostprocessor function = f887 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp888] type = FunctionValuePostprocessor function = f888 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp889] type = FunctionValuePostprocessor function = f889 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp890] type = FunctionValuePostprocessor function = f890 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp891] type = FunctionValuePostprocessor function = f891 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp892] type = FunctionValuePostprocessor function = f892 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp893] type = FunctionValuePostprocessor function = f893 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp894] type = FunctionValuePostprocessor function = f894 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp895] type = FunctionValuePostprocessor function = f895 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp896] type = FunctionValuePostprocessor function = f896 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp897] type = FunctionValuePostprocessor function = f897 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp898] type = FunctionValuePostprocessor function = f898 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp899] type = FunctionValuePostprocessor function = f899 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp900] type = FunctionValuePostprocessor function = f900 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp901] type = FunctionValuePostprocessor function = f901 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp902] type = FunctionValuePostprocessor function = f902 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp903] type = FunctionValuePostprocessor function = f903 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp904] type = FunctionValuePostprocessor function = f904 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp905] type = FunctionValuePostprocessor function = f905 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp906] type = FunctionValuePostprocessor function = f906 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp907] type = FunctionValuePostprocessor function = f907 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp908] type = FunctionValuePostprocessor function = f908 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp909] type = FunctionValuePostprocessor function = f909 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp910] type = FunctionValuePostprocessor function = f910 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp911] type = FunctionValuePostprocessor function = f911 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp912] type = FunctionValuePostprocessor function = f912 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp913] type = FunctionValuePostprocessor function = f913 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp914] type = FunctionValuePostprocessor function = f914 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp915] type = FunctionValuePostprocessor function = f915 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp916] type = FunctionValuePostprocessor function = f916 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp917] type = FunctionValuePostprocessor function = f917 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp918] type = FunctionValuePostprocessor function = f918 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp919] type = FunctionValuePostprocessor function = f919 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp920] type = FunctionValuePostprocessor function = f920 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp921] type = FunctionValuePostprocessor function = f921 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp922] type = FunctionValuePostprocessor function = f922 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp923] type = FunctionValuePostprocessor function = f923 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp924] type = FunctionValuePostprocessor function = f924 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp925] type = FunctionValuePostprocessor function = f925 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp926] type = FunctionValuePostprocessor function = f926 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp927] type = FunctionValuePostprocessor function = f927 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp928] type = FunctionValuePostprocessor function = f928 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp929] type = FunctionValuePostprocessor function = f929 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp930] type = FunctionValuePostprocessor function = f930 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp931] type = FunctionValuePostprocessor function = f931 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp932] type = FunctionValuePostprocessor function = f932 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp933] type = FunctionValuePostprocessor function = f933 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp934] type = FunctionValuePostprocessor function = f934 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp935] type = FunctionValuePostprocessor function = f935 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp936] type = FunctionValuePostprocessor function = f936 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp937] type = FunctionValuePostprocessor function = f937 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp938] type = FunctionValuePostprocessor function = f938 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp939] type = FunctionValuePostprocessor function = f939 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp940] type = FunctionValuePostprocessor function = f940 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp941] type = FunctionValuePostprocessor function = f941 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp942] type = FunctionValuePostprocessor function = f942 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp943] type = FunctionValuePostprocessor function = f943 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp944] type = FunctionValuePostprocessor function = f944 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp945] type = FunctionValuePostprocessor function = f945 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp946] type = FunctionValuePostprocessor function = f946 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp947] type = FunctionValuePostprocessor function = f947 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp948] type = FunctionValuePostprocessor function = f948 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp949] type = FunctionValuePostprocessor function = f949 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp950] type = FunctionValuePostprocessor function = f950 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp951] type = FunctionValuePostprocessor function = f951 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp952] type = FunctionValuePostprocessor function = f952 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp953] type = FunctionValuePostprocessor function = f953 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp954] type = FunctionValuePostprocessor function = f954 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp955] type = FunctionValuePostprocessor function = f955 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp956] type = FunctionValuePostprocessor function = f956 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp957] type = FunctionValuePostprocessor function = f957 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp958] type = FunctionValuePostprocessor function = f958 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp959] type = FunctionValuePostprocessor function = f959 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp960] type = FunctionValuePostprocessor function = f960 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp961] type = FunctionValuePostprocessor function = f961 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp962] type = FunctionValuePostprocessor function = f962 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp963] type = FunctionValuePostprocessor function = f963 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp964] type = FunctionValuePostprocessor function = f964 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp965] type = FunctionValuePostprocessor function = f965 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp966] type = FunctionValuePostprocessor function = f966 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp967] type = FunctionValuePostprocessor function = f967 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp968] type = FunctionValuePostprocessor function = f968 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp969] type = FunctionValuePostprocessor function = f969 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp970] type = FunctionValuePostprocessor function = f970 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp971] type = FunctionValuePostprocessor function = f971 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp972] type = FunctionValuePostprocessor function = f972 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp973] type = FunctionValuePostprocessor function = f973 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp974] type = FunctionValuePostprocessor function = f974 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp975] type = FunctionValuePostprocessor function = f975 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp976] type = FunctionValuePostprocessor function = f976 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp977] type = FunctionValuePostprocessor function = f977 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp978] type = FunctionValuePostprocessor function = f978 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp979] type = FunctionValuePostprocessor function = f979 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp980] type = FunctionValuePostprocessor function = f980 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp981] type = FunctionValuePostprocessor function = f981 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp982] type = FunctionValuePostprocessor function = f982 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp983] type = FunctionValuePostprocessor function = f983 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp984] type = FunctionValuePostprocessor function = f984 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp985] type = FunctionValuePostprocessor function = f985 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp986] type = FunctionValuePostprocessor function = f986 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp987] type = FunctionValuePostprocessor function = f987 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp988] type = FunctionValuePostprocessor function = f988 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp989] type = FunctionValuePostprocessor function = f989 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp990] type = FunctionValuePostprocessor function = f990 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp991] type = FunctionValuePostprocessor function = f991 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp992] type = FunctionValuePostprocessor function = f992 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp993] type = FunctionValuePostprocessor function = f993 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp994] type = FunctionValuePostprocessor function = f994 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp995] type = FunctionValuePostprocessor function = f995 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp996] type = FunctionValuePostprocessor function = f996 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp997] type = FunctionValuePostprocessor function = f997 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp998] type = FunctionValuePostprocessor function = f998 point = '0.5 0.5 0' execute_on = initial [../]
+  [./pp999] type = FunctionValuePostprocessor function = f999 point = '0.5 0.5 0' execute_on = initial [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
@@ -0,0 +1,44 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[VectorPostprocessors]
+  [./constant]
+    type = ConstantVectorPostprocessor
+    value = '1 2 3'
+  [../]
+[]
+
+[Postprocessors]
+  [./first]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = constant
+    vector_name = value
+    index = 0
+  [../]
+  [./last]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = constant
+    vector_name = value
+    index = 2
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,134 @@
+# The cached transfers (fixed_meshes = true) must match the uncached ones at every step while the
+# sub-app solutions change (reusing the cache) and the master mesh is refined (rebuilding it)
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  # The MultiAppInterpolationTransfer object only works with ReplicatedMesh
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./from_sub]
+  [../]
+  [./elemental_from_sub]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./reference_from_sub]
+  [../]
+  [./reference_elemental_from_sub]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Adaptivity]
+  marker = uniform
+  max_h_level = 2
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = refine
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./elemental_difference]
+    type = ElementL2Difference
+    variable = elemental_from_sub
+    other_variable = reference_elemental_from_sub
+  [../]
+  [./nodal_difference]
+    type = ElementL2Difference
+    variable = from_sub
+    other_variable = reference_from_sub
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions = '0 0 0 0.6 0 0'
+    input_files = fromsub_fixed_meshes_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./fromsub]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_sub
+    fixed_meshes = true
+  [../]
+  [./elemental_fromsub]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = elemental_from_sub
+    fixed_meshes = true
+  [../]
+  [./reference_fromsub]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = reference_from_sub
+  [../]
+  [./reference_elemental_fromsub]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = reference_elemental_from_sub
+  [../]
+[]
@@ -0,0 +1,113 @@
+# Transfers two different variables of the sub-apps (u and v) into two different variables
+# (from_u and from_v) with a single MultiAppInterpolationTransfer, and compares them with the
+# variables transferred one at a time (u_ref and v_ref), so the differences must be zero.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  # The MultiAppInterpolationTransfer object only works with ReplicatedMesh
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+    family = LAGRANGE
+    order = FIRST
+  [../]
+[]
+
+[AuxVariables]
+  [./from_u]
+  [../]
+  [./from_v]
+  [../]
+  [./u_ref]
+  [../]
+  [./v_ref]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./u_difference]
+    type = ElementL2Difference
+    variable = from_u
+    other_variable = u_ref
+  [../]
+  [./v_difference]
+    type = ElementL2Difference
+    variable = from_v
+    other_variable = v_ref
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions = '0 0 0 0.6 0 0'
+    input_files = fromsub_multiple_variables_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./from_sub]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = 'u v'
+    variable = 'from_u from_v'
+  [../]
+  [./u_ref]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = u_ref
+  [../]
+  [./v_ref]
+    type = MultiAppInterpolationTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = v
+    variable = v_ref
+  [../]
+[]
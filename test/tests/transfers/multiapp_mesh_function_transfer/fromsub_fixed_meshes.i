@@ -0,0 +1,117 @@
+# The cached transfer (fixed_meshes = true) must match the uncached one at every step while the
+# sub-app solutions change (reusing the cache) and the master mesh is refined (rebuilding it)
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./transferred_u]
+  [../]
+  [./elemental_transferred_u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./reference_u]
+  [../]
+  [./elemental_reference_u]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Adaptivity]
+  marker = uniform
+  max_h_level = 2
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = refine
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./elemental_difference]
+    type = ElementL2Difference
+    variable = elemental_transferred_u
+    other_variable = elemental_reference_u
+  [../]
+  [./nodal_difference]
+    type = ElementL2Difference
+    variable = transferred_u
+    other_variable = reference_u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 1
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub]
+    positions = '.099 .099 0 .599 .599 0 0.599 0.099 0'
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    input_files = fromsub_fixed_meshes_sub.i
+  [../]
+[]
+
+[Transfers]
+  [./from_sub]
+    source_variable = 'sub_u sub_u'
+    direction = from_multiapp
+    variable = 'transferred_u elemental_transferred_u'
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+    fixed_meshes = true
+  [../]
+  [./from_sub_reference]
+    source_variable = 'sub_u sub_u'
+    direction = from_multiapp
+    variable = 'reference_u elemental_reference_u'
+    type = MultiAppMeshFunctionTransfer
+    multi_app = sub
+  [../]
+[]
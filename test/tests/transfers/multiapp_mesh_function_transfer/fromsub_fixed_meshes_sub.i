@@ -0,0 +1,54 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+  xmin = -.01
+  xmax = 0.21
+  ymin = -.01
+  ymax = 0.21
+[]
+
+[Variables]
+  [./sub_u]
+  [../]
+[]
+
+[Functions]
+  [./right_value]
+    type = ParsedFunction
+    value = '4 + t'
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = sub_u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = sub_u
+    boundary = left
+    value = 1
+  [../]
+  [./right]
+    type = FunctionDirichletBC
+    variable = sub_u
+    boundary = right
+    function = right_value
+  [../]
+[]
+
+[Executioner]
+  # Preconditioned JFNK (default)
+  type = Transient
+  num_steps = 3
+  dt = 1
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
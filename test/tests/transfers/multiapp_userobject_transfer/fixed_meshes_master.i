@@ -0,0 +1,141 @@
+# The cached transfers (fixed_meshes = true) must match the uncached ones at every step while the
+# sub-app solutions change (reusing the cache) and the master mesh is refined (rebuilding it)
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 10
+  ny = 10
+  nz = 10
+  # The MultiAppUserObjectTransfer object only works with ReplicatedMesh
+  parallel_type = replicated
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./multi_layered_average]
+  [../]
+  [./element_multi_layered_average]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+  [./reference_multi_layered_average]
+  [../]
+  [./reference_element_multi_layered_average]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Adaptivity]
+  marker = uniform
+  max_h_level = 1
+  [./Markers]
+    [./uniform]
+      type = UniformMarker
+      mark = refine
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./element_difference]
+    type = ElementL2Difference
+    variable = element_multi_layered_average
+    other_variable = reference_element_multi_layered_average
+  [../]
+  [./nodal_difference]
+    type = ElementL2Difference
+    variable = multi_layered_average
+    other_variable = reference_multi_layered_average
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+  dt = 0.001 # This will be constrained by the multiapp
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  l_tol = 1e-8
+  nl_rel_tol = 1e-10
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub_app]
+    positions = '0.3 0.1 0.3 0.7 0.1 0.3'
+    type = TransientMultiApp
+    input_files = sub.i
+    app_type = MooseTestApp
+  [../]
+[]
+
+[Transfers]
+  [./layered_transfer]
+    direction = from_multiapp
+    user_object = layered_average
+    variable = multi_layered_average
+    type = MultiAppUserObjectTransfer
+    multi_app = sub_app
+    fixed_meshes = true
+  [../]
+  [./element_layered_transfer]
+    direction = from_multiapp
+    user_object = layered_average
+    variable = element_multi_layered_average
+    type = MultiAppUserObjectTransfer
+    multi_app = sub_app
+    fixed_meshes = true
+  [../]
+  [./reference_layered_transfer]
+    direction = from_multiapp
+    user_object = layered_average
+    variable = reference_multi_layered_average
+    type = MultiAppUserObjectTransfer
+    multi_app = sub_app
+  [../]
+  [./reference_element_layered_transfer]
+    direction = from_multiapp
+    user_object = layered_average
+    variable = reference_element_multi_layered_average
+    type = MultiAppUserObjectTransfer
+    multi_app = sub_app
+  [../]
+[]
@@ -0,0 +1,67 @@
+# The elemental and side user objects are restricted to the left half of the mesh (block 1) and to
+# the right boundary, so the user object loop only visits the elements in their union.  u = x, so
+# the average on block 1 is 0.25 and the average on the right boundary is 1.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[MeshModifiers]
+  [./left_half]
+    type = SubdomainBoundingBox
+    bottom_left = '0 0 0'
+    top_right = '0.5 1 0'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./left_average]
+    type = ElementAverageValue
+    variable = u
+    block = 1
+  [../]
+  [./right_side_average]
+    type = SideAverageValue
+    variable = u
+    boundary = right
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]